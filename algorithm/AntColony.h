@@ -0,0 +1,303 @@
+#ifndef ANT_COLONY_H
+#define ANT_COLONY_H
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "NearestNeighbor.h"
+#include "LocalSearch.h"
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/TSPUtils.h"
+#include "../utils/ThreadPool.h"
+
+// Número de formigas por iteração (0 utiliza uma formiga por nó)
+#define ACO_ANTS 0
+// Número máximo de iterações da colônia
+#define ACO_MAX_ITERATIONS 1000
+// Peso do feromônio na regra de transição
+#define ACO_ALPHA 1.0
+// Peso da heurística (inverso da distância) na regra de transição
+#define ACO_BETA 3.0
+// Taxa de evaporação do feromônio
+#define ACO_EVAPORATION 0.02
+// Tamanho das listas de candidatos consultadas na construção
+#define ACO_CANDIDATES 15
+// Número de threads de construção (0 utiliza uma por núcleo disponível)
+#define ACO_THREADS 0
+// Número de arestas a partir do qual a atratividade e a evaporação também são divididas entre as threads
+#define ACO_PARALLEL_EDGES 65536
+// A cada quantas iterações o depósito usa a melhor solução global em vez da melhor da iteração
+#define ACO_GLOBAL_BEST_PERIOD 5
+// Iterações sem melhora antes de reinicializar a trilha de feromônio
+#define ACO_RESET_ITERATIONS 250
+
+/**
+ * @brief Parâmetros do sistema de formigas MAX-MIN
+ */
+struct AntColonyParameters {
+    int ants = ACO_ANTS; // Formigas por iteração (0 utiliza uma por nó)
+    int max_iterations = ACO_MAX_ITERATIONS; // Número máximo de iterações
+    double alpha = ACO_ALPHA; // Peso do feromônio
+    double beta = ACO_BETA; // Peso da heurística
+    double evaporation = ACO_EVAPORATION; // Taxa de evaporação
+    size_t candidates = ACO_CANDIDATES; // Tamanho das listas de candidatos
+    int threads = ACO_THREADS; // Threads de construção (0 utiliza uma por núcleo)
+    unsigned int seed = 0; // Semente base (0 sorteia uma semente)
+    bool use_local_search = false; // Aplica busca local na melhor formiga de cada iteração
+    LocalSearchMethod local_search_method = LocalSearchMethod::INVERT; // Vizinhança da busca local
+    ImprovementType local_search_improvement = ImprovementType::FIRST_IMPROVEMENT; // Estratégia da busca local
+};
+
+/**
+ * @brief Constrói o caminho de uma formiga usando as listas de candidatos
+ *
+ * O próximo nó é sorteado entre os candidatos ainda não visitados com probabilidade proporcional à
+ * atratividade (feromônio^alpha * heurística^beta). Apenas quando todos os candidatos já foram
+ * visitados o nó não visitado de maior atratividade é escolhido percorrendo todos os nós.
+ *
+ * @param attractiveness Matriz plana n x n com a atratividade de cada aresta
+ * @param candidates As listas de candidatos de cada nó
+ * @param order O número de nós
+ * @param rng O gerador de números aleatórios da thread
+ * @param visited Buffer reutilizável de nós visitados
+ * @param path O caminho construído
+ */
+void construct_ant_path(const std::vector<double>& attractiveness,
+    const std::vector<std::vector<int>>& candidates, size_t order, std::mt19937& rng,
+    std::vector<char>& visited, std::vector<int>& path) {
+
+    std::uniform_real_distribution<double> probability(0.0, 1.0);
+    std::fill(visited.begin(), visited.end(), 0);
+    path.clear();
+
+    int current = std::uniform_int_distribution<int>(0, order - 1)(rng);
+    visited[current] = 1;
+    path.push_back(current);
+
+    while (path.size() < order) {
+        const double* row = attractiveness.data() + (size_t)current * order;
+        double total = 0.0;
+
+        for (int candidate : candidates[current]) {
+            if (!visited[candidate]) {
+                total += row[candidate];
+            }
+        }
+
+        int next = -1;
+
+        // Roleta restrita aos candidatos não visitados
+        if (total > 0.0) {
+            double target = probability(rng) * total;
+            for (int candidate : candidates[current]) {
+                if (visited[candidate]) {
+                    continue;
+                }
+                next = candidate;
+                target -= row[candidate];
+                if (target <= 0.0) {
+                    break;
+                }
+            }
+        } else {
+            // Todos os candidatos já visitados: escolhe o melhor nó restante
+            double best = -1.0;
+            for (size_t node = 0; node < order; node++) {
+                if (!visited[node] && row[node] > best) {
+                    best = row[node];
+                    next = node;
+                }
+            }
+        }
+
+        visited[next] = 1;
+        path.push_back(next);
+        current = next;
+    }
+}
+
+/**
+ * @brief Executa o sistema de formigas MAX-MIN (MMAS)
+ *
+ * As formigas de cada iteração são divididas entre as threads de um WorkStealingPool criado uma vez
+ * por execução, cada uma com seu próprio gerador e buffers. O feromônio é mantido em uma matriz plana
+ * limitada ao intervalo [tau_min, tau_max], e a atratividade e a evaporação são laços contínuos sobre
+ * essa matriz que o compilador consegue vetorizar; a partir de ACO_PARALLEL_EDGES arestas eles são
+ * divididos em blocos entre as mesmas threads. Opcionalmente a melhor formiga da iteração passa pela
+ * busca local antes do depósito.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param params Os parâmetros da colônia
+ * @param control Os critérios de parada e o callback de melhora
+ * @return O melhor caminho encontrado, seu custo e o limitante inferior da instância
+ */
+template<typename Node>
+TSPResult ant_colony_search(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights,
+    const AntColonyParameters& params = AntColonyParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+    size_t order = graph.get_order();
+
+    TSPResult best;
+    best.path = nearest_neighbor(graph, weights, graph.get_node(0));
+    best.cost = calculate_path_cost(weights, best.path);
+    best.lower_bound = monitor.lower_bound();
+    monitor.improve(best.path, best.cost);
+
+    if (order < 4) {
+        monitor.finish();
+        return best;
+    }
+
+    bool symmetric = is_symmetric(weights);
+    std::vector<std::vector<int>> candidates = build_candidate_lists(weights, params.candidates);
+
+    int ants = params.ants > 0 ? params.ants : (int)order;
+    int threads = params.threads > 0 ? params.threads : (int)std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, ants);
+
+    // Heurística: inverso da distância, pré-elevada a beta
+    std::vector<double> heuristic(order * order, 0.0);
+    for (size_t i = 0; i < order; i++) {
+        for (size_t j = 0; j < order; j++) {
+            double weight = weights[i][j];
+            if (i != j && std::isfinite(weight)) {
+                heuristic[i * order + j] = std::pow(1.0 / std::max(weight, 1e-10), params.beta);
+            }
+        }
+    }
+
+    // Limites do feromônio, derivados do custo da melhor solução
+    double tau_max = 1.0 / (params.evaporation * best.cost);
+    double tau_min = tau_max / (2.0 * order);
+    std::vector<double> pheromone(order * order, tau_max);
+    std::vector<double> attractiveness(order * order, 0.0);
+
+    // Estado de cada thread: gerador, buffers e caminhos das suas formigas
+    unsigned int base_seed = params.seed != 0 ? params.seed : std::random_device{}();
+    std::vector<std::mt19937> generators;
+    std::vector<std::vector<char>> visited(threads, std::vector<char>(order, 0));
+    for (int t = 0; t < threads; t++) {
+        generators.emplace_back(base_seed + t);
+    }
+    std::vector<std::vector<int>> ant_paths(ants);
+    std::vector<double> ant_costs(ants, 0.0);
+
+    auto construct_range = [&](size_t thread_index) {
+        for (int ant = thread_index; ant < ants; ant += threads) {
+            construct_ant_path(attractiveness, candidates, order, generators[thread_index],
+                               visited[thread_index], ant_paths[ant]);
+            ant_costs[ant] = calculate_path_cost(weights, ant_paths[ant]);
+        }
+    };
+
+    // Threads persistentes; a thread que executa a busca assume a primeira porção de cada lote
+    std::unique_ptr<WorkStealingPool> pool;
+    if (threads > 1) {
+        pool = std::make_unique<WorkStealingPool>(threads - 1);
+    }
+
+    // Divide as arestas [0, order * order) em blocos contínuos, um por thread
+    size_t edges = order * order;
+    auto for_edge_blocks = [&](const std::function<void(size_t, size_t)>& body) {
+        if (!pool || edges < ACO_PARALLEL_EDGES) {
+            body(0, edges);
+            return;
+        }
+        pool->run_batch(threads, [&](size_t t) {
+            body(edges * t / threads, edges * (t + 1) / threads);
+        });
+    };
+
+    int stagnant_iterations = 0;
+
+    for (int iteration = 0; iteration < params.max_iterations; iteration++) {
+        if (monitor.should_stop()) {
+            break;
+        }
+
+        // Atratividade de cada aresta para a iteração atual
+        for_edge_blocks([&](size_t first, size_t last) {
+            for (size_t k = first; k < last; k++) {
+                double tau = params.alpha == 1.0 ? pheromone[k] : std::pow(pheromone[k], params.alpha);
+                attractiveness[k] = tau * heuristic[k];
+            }
+        });
+
+        // Construção paralela das soluções
+        if (!pool) {
+            construct_range(0);
+        } else {
+            pool->run_batch(threads, construct_range);
+        }
+
+        int iteration_best = std::min_element(ant_costs.begin(), ant_costs.end()) - ant_costs.begin();
+        std::vector<int> iteration_path = ant_paths[iteration_best];
+        double iteration_cost = ant_costs[iteration_best];
+
+        if (params.use_local_search) {
+            LocalSearchResult improved = local_search(weights, iteration_path,
+                params.local_search_method, params.local_search_improvement);
+            iteration_path = improved.solution;
+            iteration_cost = improved.cost;
+        }
+
+        if (iteration_cost < best.cost - IMPROVEMENT_EPSILON) {
+            best.path = iteration_path;
+            best.cost = iteration_cost;
+            tau_max = 1.0 / (params.evaporation * best.cost);
+            tau_min = tau_max / (2.0 * order);
+            stagnant_iterations = 0;
+            monitor.improve(best.path, best.cost);
+        } else {
+            stagnant_iterations++;
+        }
+        monitor.iteration();
+
+        // Reinicializa a trilha quando a colônia estagna
+        if (stagnant_iterations >= ACO_RESET_ITERATIONS) {
+            std::fill(pheromone.begin(), pheromone.end(), tau_max);
+            stagnant_iterations = 0;
+            continue;
+        }
+
+        // Evaporação com o limite inferior aplicado no mesmo laço
+        double persistence = 1.0 - params.evaporation;
+        for_edge_blocks([&](size_t first, size_t last) {
+            for (size_t k = first; k < last; k++) {
+                pheromone[k] = std::max(tau_min, pheromone[k] * persistence);
+            }
+        });
+
+        // Depósito pela melhor formiga da iteração ou pela melhor solução global
+        bool use_global_best = iteration % ACO_GLOBAL_BEST_PERIOD == ACO_GLOBAL_BEST_PERIOD - 1;
+        const std::vector<int>& deposit_path = use_global_best ? best.path : iteration_path;
+        double deposit = 1.0 / (use_global_best ? best.cost : iteration_cost);
+
+        for (size_t k = 0; k < order; k++) {
+            int from = deposit_path[k];
+            int to = deposit_path[(k + 1) % order];
+            pheromone[from * order + to] = std::min(tau_max, pheromone[from * order + to] + deposit);
+            if (symmetric) {
+                pheromone[to * order + from] = std::min(tau_max, pheromone[to * order + from] + deposit);
+            }
+        }
+    }
+
+    monitor.finish();
+    return best;
+}
+
+#endif
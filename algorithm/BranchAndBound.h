@@ -0,0 +1,350 @@
+#ifndef BRANCH_AND_BOUND_H
+#define BRANCH_AND_BOUND_H
+
+#include <vector>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "../utils/ThreadPool.h"
+#include "../utils/TSPUtils.h"
+#include "NearestNeighbor.h"
+#include "LocalSearch.h"
+#include "LowerBound.h"
+#include "SolverControl.h"
+#include "TSPResult.h"
+
+// Tempo limite sugerido para o branch-and-bound em milissegundos
+#define BRANCH_AND_BOUND_TIME_LIMIT_MS 5000
+// Profundidade até a qual cada subproblema é submetido como tarefa ao conjunto de threads
+#define BRANCH_AND_BOUND_SPLIT_DEPTH 3
+
+/**
+ * @brief Parâmetros do branch-and-bound
+ */
+struct BranchAndBoundParameters {
+    int threads = 0; // Threads de exploração (0 utiliza uma por núcleo)
+    int subgradient_iterations = SUBGRADIENT_ITERATIONS; // Iterações do limitante na raiz
+    size_t split_depth = BRANCH_AND_BOUND_SPLIT_DEPTH; // Profundidade das tarefas paralelas
+};
+
+/**
+ * @brief Estrutura para armazenar o resultado do branch-and-bound; o limitante inferior é certificado
+ */
+struct BranchAndBoundResult : TSPResult {
+    bool optimal; // Indica se o caminho foi provado ótimo
+    size_t explored_nodes; // Número de subproblemas explorados
+
+    BranchAndBoundResult() : optimal(false), explored_nodes(0) {}
+};
+
+/**
+ * @brief Estado compartilhado entre as threads do branch-and-bound
+ */
+struct BranchAndBoundState {
+    const std::vector<std::vector<double>>* weights;
+    std::vector<double> penalties; // Penalidades de Held-Karp obtidas na raiz
+    BranchAndBoundParameters params;
+    double gap_tolerance; // Gap relativo aceito para descartar subproblemas
+    SolverMonitor* monitor;
+    WorkStealingPool* pool;
+
+    std::atomic<double> upper_bound; // Custo do melhor caminho conhecido
+    std::atomic<double> open_bound; // Menor limitante entre os subproblemas descartados sem prova
+    std::atomic<size_t> explored_nodes;
+    std::mutex best_mutex;
+    std::vector<int> best_path;
+};
+
+/**
+ * @brief Reduz um valor atômico para o mínimo entre ele e um candidato
+ * @param value O valor atômico
+ * @param candidate O candidato
+ * @return true se o valor foi reduzido
+ */
+bool atomic_min(std::atomic<double>& value, double candidate) {
+    double current = value.load();
+    while (candidate < current) {
+        if (value.compare_exchange_weak(current, candidate)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Calcula o limitante inferior do custo para completar um caminho parcial
+ *
+ * O restante do ciclo sai do último nó, visita todos os nós livres R e volta ao nó inicial. Com os
+ * pesos penalizados, esse trecho custa pelo menos uma árvore geradora mínima de R mais a aresta de
+ * saída e a de chegada mais baratas, e a soma das penalidades de R é descontada duas vezes.
+ *
+ * @param state O estado do branch-and-bound
+ * @param visited Marcadores dos nós já presentes no caminho parcial
+ * @param remaining O número de nós livres
+ * @param last O último nó do caminho parcial
+ * @param first O nó inicial do caminho
+ * @return O limitante inferior do custo restante
+ */
+double completion_bound(const BranchAndBoundState& state, const std::vector<char>& visited, size_t remaining,
+    int last, int first) {
+
+    const std::vector<std::vector<double>>& weights = *state.weights;
+    const std::vector<double>& pi = state.penalties;
+    const double infinity = std::numeric_limits<double>::infinity();
+    int order = weights.size();
+
+    if (remaining == 0) {
+        return weights[last][first];
+    }
+
+    double leave = infinity, arrive = infinity, penalty_sum = 0.0;
+    std::vector<int> free_nodes;
+    free_nodes.reserve(remaining);
+    for (int node = 0; node < order; node++) {
+        if (!visited[node]) {
+            free_nodes.push_back(node);
+            leave = std::min(leave, weights[last][node] + pi[node]);
+            arrive = std::min(arrive, weights[node][first] + pi[node]);
+            penalty_sum += pi[node];
+        }
+    }
+
+    // Prim sobre os nós livres
+    std::vector<double> distance(free_nodes.size(), infinity);
+    std::vector<char> in_tree(free_nodes.size(), 0);
+    double tree_cost = 0.0;
+    distance[0] = 0.0;
+
+    for (size_t step = 0; step < free_nodes.size(); step++) {
+        size_t next = free_nodes.size();
+        for (size_t k = 0; k < free_nodes.size(); k++) {
+            if (!in_tree[k] && (next == free_nodes.size() || distance[k] < distance[next])) {
+                next = k;
+            }
+        }
+
+        in_tree[next] = 1;
+        tree_cost += distance[next];
+
+        int a = free_nodes[next];
+        for (size_t k = 0; k < free_nodes.size(); k++) {
+            if (!in_tree[k]) {
+                int b = free_nodes[k];
+                double candidate = std::min(weights[a][b], weights[b][a]) + pi[a] + pi[b];
+                distance[k] = std::min(distance[k], candidate);
+            }
+        }
+    }
+
+    return tree_cost + leave + arrive - 2.0 * penalty_sum;
+}
+
+/**
+ * @brief Indica se um subproblema com o limitante dado pode ser descartado
+ * @param state O estado do branch-and-bound
+ * @param bound O limitante inferior do subproblema
+ * @return true se o subproblema não pode conter um caminho melhor além da tolerância
+ */
+bool prune_subproblem(BranchAndBoundState& state, double bound) {
+    double upper_bound = state.upper_bound.load();
+
+    if (bound >= upper_bound - IMPROVEMENT_EPSILON) {
+        return true;
+    }
+
+    // Descartado apenas pela tolerância: o limitante continua em aberto
+    if (bound * (1.0 + state.gap_tolerance) >= upper_bound) {
+        atomic_min(state.open_bound, bound);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Explora em profundidade os caminhos que estendem um caminho parcial
+ *
+ * Os filhos são ordenados pelo limitante e explorados do mais promissor ao menos promissor. Até a
+ * profundidade de divisão cada filho vira uma tarefa no conjunto de threads; abaixo dela a exploração é
+ * sequencial. Quando o controle encerra a busca, o limitante do subproblema é registrado como aberto.
+ *
+ * @param state O estado do branch-and-bound
+ * @param path O caminho parcial começando no nó inicial
+ * @param visited Marcadores dos nós presentes no caminho parcial
+ * @param cost O custo do caminho parcial
+ * @param bound O limitante inferior do subproblema
+ */
+void explore_subproblem(BranchAndBoundState& state, std::vector<int>& path, std::vector<char>& visited,
+    double cost, double bound) {
+
+    const std::vector<std::vector<double>>& weights = *state.weights;
+    size_t order = weights.size();
+
+    if (prune_subproblem(state, bound)) {
+        return;
+    }
+
+    if (state.monitor->should_stop()) {
+        atomic_min(state.open_bound, bound);
+        return;
+    }
+
+    state.explored_nodes++;
+    int last = path.back();
+
+    if (path.size() == order) {
+        double total = cost + weights[last][path[0]];
+        if (atomic_min(state.upper_bound, total)) {
+            std::lock_guard<std::mutex> lock(state.best_mutex);
+            // Outra thread pode ter registrado um caminho ainda melhor nesse intervalo
+            if (state.upper_bound.load() == total) {
+                state.best_path = path;
+                state.monitor->improve(path, total);
+            }
+        }
+        return;
+    }
+
+    // Limitante de cada filho
+    std::vector<std::pair<double, int>> children;
+    size_t remaining = order - path.size() - 1;
+    for (size_t node = 0; node < order; node++) {
+        if (visited[node]) {
+            continue;
+        }
+        visited[node] = 1;
+        double child_cost = cost + weights[last][node];
+        double child_bound = child_cost + completion_bound(state, visited, remaining, node, path[0]);
+        visited[node] = 0;
+        children.push_back({std::max(child_bound, bound), (int)node});
+    }
+    std::sort(children.begin(), children.end());
+
+    for (const auto& child : children) {
+        double child_cost = cost + weights[last][child.second];
+
+        if (path.size() < state.params.split_depth) {
+            std::vector<int> child_path = path;
+            std::vector<char> child_visited = visited;
+            child_path.push_back(child.second);
+            child_visited[child.second] = 1;
+            double child_bound = child.first;
+
+            state.pool->submit([&state, child_path, child_visited, child_cost, child_bound]() mutable {
+                explore_subproblem(state, child_path, child_visited, child_cost, child_bound);
+            });
+        } else {
+            path.push_back(child.second);
+            visited[child.second] = 1;
+            explore_subproblem(state, path, visited, child_cost, child.first);
+            visited[child.second] = 0;
+            path.pop_back();
+        }
+    }
+}
+
+/**
+ * @brief Resolve o problema do caixeiro viajante por branch-and-bound com limitantes de 1-árvore
+ *
+ * O limitante superior inicial é o melhor resultado do vizinho mais próximo com busca local 2-opt a
+ * partir de cada nó. Na raiz, as penalidades de Held-Karp são otimizadas por subgradiente e então
+ * reutilizadas no limitante de todos os subproblemas. Os caminhos parciais partem do nó 0 e os
+ * subproblemas rasos são distribuídos em um conjunto de threads com roubo de tarefas.
+ *
+ * O limitante inferior retornado é certificado: é o maior entre o limitante da raiz e o menor limitante
+ * dos subproblemas que não foram explorados (por parada antecipada ou pelo gap desejado do controle,
+ * usado como tolerância de poda), limitado pelo custo encontrado. Quando a busca termina sem
+ * subproblemas em aberto, o caminho é ótimo.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param params Os parâmetros do branch-and-bound
+ * @param control Os critérios de parada e o callback de melhora
+ * @return O melhor caminho, seu custo e o limitante inferior certificado
+ */
+template<typename Node>
+BranchAndBoundResult branch_and_bound(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weights,
+    const BranchAndBoundParameters& params = BranchAndBoundParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    size_t order = weights.size();
+    BranchAndBoundResult result;
+
+    if (order <= 3) {
+        for (size_t node = 0; node < order; node++) {
+            result.path.push_back(node);
+        }
+        result.cost = order > 1 ? calculate_path_cost(weights, result.path) : 0.0;
+        if (order == 3) {
+            std::vector<int> reversed = {0, 2, 1};
+            double reversed_cost = calculate_path_cost(weights, reversed);
+            if (reversed_cost < result.cost) {
+                result.path = reversed;
+                result.cost = reversed_cost;
+            }
+        }
+        result.lower_bound = result.cost;
+        result.optimal = true;
+        return result;
+    }
+
+    BranchAndBoundState state;
+    state.weights = &weights;
+    SolverMonitor monitor(control, weights);
+    state.params = params;
+    state.gap_tolerance = std::max(0.0, control.gap_target);
+    state.monitor = &monitor;
+    state.open_bound = std::numeric_limits<double>::infinity();
+    state.explored_nodes = 0;
+
+    // Limitante superior inicial
+    TSPResult seed;
+    seed.cost = std::numeric_limits<double>::infinity();
+    for (size_t start = 0; start < order; start++) {
+        TSPResult candidate = nearest_neighbor_local_search(graph, weights, graph.get_node(start),
+            LocalSearchMethod::INVERT, ImprovementType::FIRST_IMPROVEMENT);
+        if (candidate.cost < seed.cost) {
+            seed = candidate;
+        }
+    }
+
+    // O caminho é rotacionado para começar no nó 0, como os caminhos da árvore de busca
+    std::rotate(seed.path.begin(), std::find(seed.path.begin(), seed.path.end(), 0), seed.path.end());
+    state.upper_bound = seed.cost;
+    state.best_path = seed.path;
+    monitor.improve(seed.path, seed.cost);
+
+    double root_bound = held_karp_bound(weights, seed.cost, params.subgradient_iterations, state.penalties);
+
+    {
+        WorkStealingPool pool(params.threads > 0 ? params.threads : 0);
+        state.pool = &pool;
+
+        std::vector<int> path = {0};
+        std::vector<char> visited(order, 0);
+        visited[0] = 1;
+        double bound = std::max(root_bound, completion_bound(state, visited, order - 1, 0, 0));
+
+        pool.submit([&state, path, visited, bound]() mutable {
+            explore_subproblem(state, path, visited, 0.0, bound);
+        });
+        pool.wait();
+    }
+
+    result.path = state.best_path;
+    result.cost = state.upper_bound.load();
+    result.lower_bound = std::min(result.cost, std::max({root_bound, monitor.lower_bound(), state.open_bound.load()}));
+    result.optimal = result.lower_bound >= result.cost - IMPROVEMENT_EPSILON;
+    result.explored_nodes = state.explored_nodes.load();
+    monitor.finish();
+
+    return result;
+}
+
+#endif // BRANCH_AND_BOUND_H
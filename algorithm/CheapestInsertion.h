@@ -7,23 +7,32 @@
 #include <utility>
 #include <cstddef>
 #include <iostream>
+#include <chrono>
 
 
 #include "../graph/IGraph.h"
 #include "TSPResult.h"
 #include "LocalSearch.h"
+#include "SolverControl.h"
 
 /**
  * @brief Implementa o algoritmo da inserção mais barata
+ *
+ * O tempo limite e o cancelamento do controle são verificados a cada inserção; quando a construção é
+ * interrompida, os nós ainda não inseridos são acrescentados ao final na ordem dos índices.
+ *
  * @param graph O grafo para aplicação do algoritmo
  * @param weights A matriz de pesos
  * @param start_node O nó inicial
+ * @param control O tempo limite e o cancelamento
  * @return a ordem dos índices dos nós visitados no percurso
  */
 template<typename Node>
 std::vector<int> cheapest_insertion(const IGraph<Node>& graph,
-    const std::vector<std::vector<double>>& weights, Node start_node) {
+    const std::vector<std::vector<double>>& weights, Node start_node,
+    const SolverControl& control = SolverControl()) {
 
+    auto start_time = std::chrono::steady_clock::now();
     int start_index = graph.get_index(start_node);
 
     size_t graph_order = graph.get_order();
@@ -56,6 +65,16 @@ std::vector<int> cheapest_insertion(const IGraph<Node>& graph,
 
     // Enquanto existirem nós não inseridos na rota
     while (path.size() < graph_order) {
+        if (control_expired(control, std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start_time).count())) {
+            for (size_t node = 0; node < graph_order; node++) {
+                if (!in_path[node]) {
+                    path.push_back(node);
+                }
+            }
+            break;
+        }
+
         double best_increase = std::numeric_limits<double>::infinity();
         int best_node = -1;
         size_t best_position = 0;
@@ -94,25 +113,34 @@ std::vector<int> cheapest_insertion(const IGraph<Node>& graph,
 
 /**
  * @brief Combina o algoritmo da inserção mais próxima com busca local
+ *
+ * A busca local respeita o tempo limite e o cancelamento do controle, e o callback de melhora recebe o
+ * caminho final.
+ *
  * @tparam Node O tipo de dado dos nós no grafo
  * @param start_node O nó inicial
  * @param graph O grafo
  * @param weights A matriz de pesos
+ * @param control O tempo limite, o cancelamento e o callback de melhora
  */
 template<typename Node>
 TSPResult cheapest_insertion_local_search(const IGraph<Node>& graph,
     const std::vector<std::vector<double>>& weights, Node start_node, 
-    LocalSearchMethod method, ImprovementType improvement) {
-
+    LocalSearchMethod method, ImprovementType improvement, const SolverControl& control = SolverControl()) {
 
-    std::vector<int> initial_path = cheapest_insertion(graph, weights, start_node);
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<int> initial_path = cheapest_insertion(graph, weights, start_node, control);
 
-    LocalSearchResult local_search_result = local_search(weights, initial_path, method, improvement);
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    LocalSearchResult local_search_result = local_search(weights, initial_path, method, improvement,
+                                                         local_search_budget(control, elapsed_ms));
 
     TSPResult result;
     result.cost = local_search_result.cost;
     result.path = local_search_result.solution;
 
+    report_result(control, result,
+                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count());
     return result;
 }
 
@@ -0,0 +1,317 @@
+#ifndef EDGE_ASSEMBLY_CROSSOVER_H
+#define EDGE_ASSEMBLY_CROSSOVER_H
+
+#include <vector>
+#include <array>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+#include "../utils/TSPUtils.h"
+
+// Número de filhos gerados (um por ciclo AB sorteado) a cada aplicação do EAX
+#define EAX_OFFSPRING_NUMBER 10
+// Tamanho das listas de candidatos consultadas na junção de subciclos
+#define EAX_CANDIDATES 10
+
+/**
+ * @brief Representação não direcionada de um caminho: os dois vizinhos de cada nó
+ */
+typedef std::vector<std::array<int, 2>> TourLinks;
+
+/**
+ * @brief Converte um caminho na representação por vizinhos
+ * @param path O caminho
+ * @return Os dois vizinhos de cada nó no ciclo
+ */
+TourLinks path_to_links(const std::vector<int>& path) {
+    size_t total_nodes = path.size();
+    TourLinks links(total_nodes);
+
+    for (size_t k = 0; k < total_nodes; k++) {
+        links[path[k]][0] = path[(k + total_nodes - 1) % total_nodes];
+        links[path[k]][1] = path[(k + 1) % total_nodes];
+    }
+
+    return links;
+}
+
+/**
+ * @brief Substitui um vizinho de um nó por outro
+ * @param links A representação por vizinhos
+ * @param node O nó a ser alterado
+ * @param old_neighbor O vizinho removido
+ * @param new_neighbor O vizinho inserido
+ */
+void replace_link(TourLinks& links, int node, int old_neighbor, int new_neighbor) {
+    if (links[node][0] == old_neighbor) {
+        links[node][0] = new_neighbor;
+    } else {
+        links[node][1] = new_neighbor;
+    }
+}
+
+/**
+ * @brief Decompõe as arestas não comuns de dois pais em ciclos AB
+ *
+ * Um ciclo AB é uma trilha fechada que alterna arestas exclusivas do pai A e do pai B. Como cada nó tem
+ * a mesma quantidade de arestas exclusivas de A e de B, uma caminhada alternada iniciada por uma aresta
+ * de A sempre consegue continuar e termina ao voltar à origem por uma aresta de B.
+ *
+ * @param first_links Os vizinhos de cada nó no pai A
+ * @param second_links Os vizinhos de cada nó no pai B
+ * @param rng O gerador de números aleatórios
+ * @return Os ciclos AB como sequências de nós (v0, v1, ..., v0); as arestas de A são (v2i, v2i+1)
+ */
+std::vector<std::vector<int>> build_ab_cycles(const TourLinks& first_links, const TourLinks& second_links,
+    std::mt19937& rng) {
+
+    size_t total_nodes = first_links.size();
+
+    auto has_link = [](const TourLinks& links, int a, int b) {
+        return links[a][0] == b || links[a][1] == b;
+    };
+
+    // Arestas exclusivas de cada pai ainda não utilizadas, por nó
+    std::vector<std::vector<int>> remaining_first(total_nodes), remaining_second(total_nodes);
+    for (size_t node = 0; node < total_nodes; node++) {
+        for (int side = 0; side < 2; side++) {
+            if (!has_link(second_links, node, first_links[node][side])) {
+                remaining_first[node].push_back(first_links[node][side]);
+            }
+            if (!has_link(first_links, node, second_links[node][side])) {
+                remaining_second[node].push_back(second_links[node][side]);
+            }
+        }
+    }
+
+    auto take_edge = [&](std::vector<std::vector<int>>& remaining, int from) {
+        std::vector<int>& options = remaining[from];
+        size_t choice = options.size() > 1 ? std::uniform_int_distribution<size_t>(0, options.size() - 1)(rng) : 0;
+        int to = options[choice];
+        options.erase(options.begin() + choice);
+        remaining[to].erase(std::find(remaining[to].begin(), remaining[to].end(), from));
+        return to;
+    };
+
+    std::vector<std::vector<int>> cycles;
+
+    for (size_t start = 0; start < total_nodes; start++) {
+        while (!remaining_first[start].empty()) {
+            std::vector<int> cycle = {(int)start};
+            int current = start;
+            bool from_first = true;
+
+            // Alterna arestas de A e de B até voltar à origem por uma aresta de B
+            do {
+                current = take_edge(from_first ? remaining_first : remaining_second, current);
+                cycle.push_back(current);
+                from_first = !from_first;
+            } while (!(current == (int)start && from_first));
+
+            cycles.push_back(cycle);
+        }
+    }
+
+    return cycles;
+}
+
+/**
+ * @brief Une os subciclos de uma solução intermediária em um único ciclo
+ *
+ * O menor subciclo é sempre unido a outro por uma troca do tipo 2-opt: uma aresta de cada subciclo é
+ * removida e as extremidades são religadas da forma mais barata. Os nós do outro subciclo são buscados
+ * primeiro nas listas de candidatos e, apenas se nenhum for encontrado, entre todos os nós.
+ *
+ * @param links A solução intermediária, alterada no lugar
+ * @param weights A matriz de pesos
+ * @param candidates As listas de candidatos
+ * @return A variação de custo provocada pelas junções
+ */
+double merge_subtours(TourLinks& links, const std::vector<std::vector<double>>& weights,
+    const std::vector<std::vector<int>>& candidates) {
+
+    int total_nodes = links.size();
+    std::vector<int> label(total_nodes, -1);
+    std::vector<std::vector<int>> subtours;
+
+    // Identifica os subciclos percorrendo os vizinhos
+    for (int start = 0; start < total_nodes; start++) {
+        if (label[start] != -1) {
+            continue;
+        }
+        std::vector<int> members;
+        int previous = -1, current = start;
+        do {
+            label[current] = subtours.size();
+            members.push_back(current);
+            int next = links[current][0] != previous ? links[current][0] : links[current][1];
+            previous = current;
+            current = next;
+        } while (current != start);
+        subtours.push_back(members);
+    }
+
+    double total_delta = 0.0;
+    size_t alive = subtours.size();
+
+    while (alive > 1) {
+        // Menor subciclo ainda não unido
+        int smallest = -1;
+        for (size_t s = 0; s < subtours.size(); s++) {
+            if (!subtours[s].empty() && (smallest == -1 || subtours[s].size() < subtours[smallest].size())) {
+                smallest = s;
+            }
+        }
+
+        double best_delta = std::numeric_limits<double>::infinity();
+        int best_u = -1, best_u2 = -1, best_v = -1, best_v2 = -1;
+
+        auto evaluate = [&](int u, int u2, int v) {
+            for (int v2 : links[v]) {
+                double removed = weights[u][u2] + weights[v][v2];
+                double straight = weights[u][v] + weights[u2][v2] - removed;
+                double crossed = weights[u][v2] + weights[u2][v] - removed;
+                if (straight < best_delta) {
+                    best_delta = straight;
+                    best_u = u; best_u2 = u2; best_v = v; best_v2 = v2;
+                }
+                if (crossed < best_delta) {
+                    best_delta = crossed;
+                    best_u = u; best_u2 = u2; best_v = v2; best_v2 = v;
+                }
+            }
+        };
+
+        for (int u : subtours[smallest]) {
+            for (int u2 : links[u]) {
+                for (int v : candidates[u]) {
+                    if (label[v] != smallest) {
+                        evaluate(u, u2, v);
+                    }
+                }
+            }
+        }
+
+        if (best_u == -1) {
+            for (int u : subtours[smallest]) {
+                for (int u2 : links[u]) {
+                    for (int v = 0; v < total_nodes; v++) {
+                        if (label[v] != smallest) {
+                            evaluate(u, u2, v);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Remove (u, u2) e (v, v2) e adiciona (u, v) e (u2, v2)
+        replace_link(links, best_u, best_u2, best_v);
+        replace_link(links, best_u2, best_u, best_v2);
+        replace_link(links, best_v, best_v2, best_u);
+        replace_link(links, best_v2, best_v, best_u2);
+        total_delta += best_delta;
+
+        // O subciclo menor passa a fazer parte do outro
+        int target = label[best_v];
+        for (int node : subtours[smallest]) {
+            label[node] = target;
+        }
+        subtours[target].insert(subtours[target].end(), subtours[smallest].begin(), subtours[smallest].end());
+        subtours[smallest].clear();
+        alive--;
+    }
+
+    return total_delta;
+}
+
+/**
+ * @brief Converte a representação por vizinhos de volta em um caminho
+ * @param links Os vizinhos de cada nó em um único ciclo
+ * @return O caminho começando no nó 0
+ */
+std::vector<int> links_to_path(const TourLinks& links) {
+    std::vector<int> path;
+    path.reserve(links.size());
+
+    int previous = -1, current = 0;
+    do {
+        path.push_back(current);
+        int next = links[current][0] != previous ? links[current][0] : links[current][1];
+        previous = current;
+        current = next;
+    } while (current != 0 && path.size() < links.size());
+
+    return path;
+}
+
+/**
+ * @brief Realiza o crossover por montagem de arestas (EAX) com a estratégia de um ciclo AB por filho
+ *
+ * Para cada ciclo AB sorteado, o filho parte do pai A, remove as arestas de A do ciclo e adiciona as de
+ * B, e os subciclos resultantes são unidos. O custo de cada filho é obtido de forma incremental a partir
+ * do custo de A, das arestas trocadas e das junções, sem percorrer o caminho. A matriz de pesos deve ser
+ * simétrica.
+ *
+ * @param first O pai A
+ * @param second O pai B
+ * @param weights A matriz de pesos simétrica
+ * @param candidates As listas de candidatos usadas na junção de subciclos
+ * @param rng O gerador de números aleatórios
+ * @param offspring_number O número de filhos gerados, dos quais o melhor é retornado
+ * @return O caminho do melhor filho; igual ao pai A quando os pais são iguais
+ */
+std::vector<int> edge_assembly_crossover(const std::vector<int>& first, const std::vector<int>& second,
+    const std::vector<std::vector<double>>& weights, const std::vector<std::vector<int>>& candidates,
+    std::mt19937& rng, int offspring_number = EAX_OFFSPRING_NUMBER) {
+
+    if (first.size() < 4) {
+        return first;
+    }
+
+    TourLinks first_links = path_to_links(first);
+    TourLinks second_links = path_to_links(second);
+    std::vector<std::vector<int>> cycles = build_ab_cycles(first_links, second_links, rng);
+
+    if (cycles.empty()) {
+        return first;
+    }
+
+    std::shuffle(cycles.begin(), cycles.end(), rng);
+    double first_cost = calculate_path_cost(weights, first);
+
+    double best_cost = std::numeric_limits<double>::infinity();
+    TourLinks best_links;
+
+    for (int child = 0; child < offspring_number && child < (int)cycles.size(); child++) {
+        const std::vector<int>& cycle = cycles[child];
+        TourLinks links = first_links;
+        double cost = first_cost;
+
+        // Remove as arestas de A do ciclo
+        for (size_t k = 0; k + 1 < cycle.size(); k += 2) {
+            replace_link(links, cycle[k], cycle[k + 1], -1);
+            replace_link(links, cycle[k + 1], cycle[k], -1);
+            cost -= weights[cycle[k]][cycle[k + 1]];
+        }
+
+        // Adiciona as arestas de B do ciclo nas posições liberadas
+        for (size_t k = 1; k + 1 < cycle.size(); k += 2) {
+            replace_link(links, cycle[k], -1, cycle[k + 1]);
+            replace_link(links, cycle[k + 1], -1, cycle[k]);
+            cost += weights[cycle[k]][cycle[k + 1]];
+        }
+
+        cost += merge_subtours(links, weights, candidates);
+
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_links = links;
+        }
+    }
+
+    return links_to_path(best_links);
+}
+
+#endif // EDGE_ASSEMBLY_CROSSOVER_H
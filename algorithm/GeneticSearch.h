@@ -4,12 +4,18 @@
 #include <vector>
 #include <random>
 #include <algorithm>
-#include <cstdlib>
-#include <ctime>
+#include <cstdint>
+#include <unordered_map>
 #include "../graph/IGraph.h"
 #include "CheapestInsertion.h"
 #include "NearestNeighbor.h"
+#include "PartitionCrossover.h"
+#include "EdgeAssemblyCrossover.h"
+#include "SolverControl.h"
+#include "PopulationArena.h"
+#include "LocalSearch.h"
 #include "../utils/TSPUtils.h"
+#include "../utils/TourHash.h"
 
 // Tamanho da população durante o algoritmo genético
 #define POPULATION_SIZE 500
@@ -17,16 +23,183 @@
 #define MAX_ITERATIONS_NUMBER 10000
 // Percentual de mutação dos indivíduos
 #define MUTATION_PERCENT 0.5
+// Número de iterações de um ciclo de seleção de pais
+#define SELECTION_CYCLE 4
+// Iterações de cada ciclo de seleção em que os pais são sorteados em vez de escolhidos pelo elitismo
+#define RANDOM_SELECTIONS 1
+// Número de indivíduos sorteados em cada torneio da seleção por torneio
+#define TOURNAMENT_SIZE 3
+// Pressão da seleção por ranking linear, entre 1 (uniforme) e 2 (o pior nunca é escolhido)
+#define RANK_SELECTION_PRESSURE 1.5
+// Número de filhos gerados e melhorados pela busca local a cada geração do algoritmo memético
+#define OFFSPRING_BATCH_SIZE 2
+// Threads da busca local dos filhos no algoritmo memético (0 utiliza uma por núcleo disponível)
+#define MEMETIC_THREADS 0
+// Distância máxima, em percentual acima do custo da melhor solução, para que um filho passe pela busca local
+// (0 aplica a busca local em todos os filhos)
+#define LOCAL_SEARCH_THRESHOLD_PERCENT 20
+// Movimentos de melhora aplicados a cada filho pela busca local do algoritmo memético (0 sem limite)
+#define LOCAL_SEARCH_MAX_MOVES 0
+// Tempo máximo, em milissegundos, da busca local de cada filho (0 sem limite)
+#define LOCAL_SEARCH_MAX_MS 0
+
+/**
+ * @brief Enum para os operadores de cruzamento disponíveis
+ */
+enum class CrossoverType {
+    ORDERED,
+    GPX,
+    EAX
+};
+
+/**
+ * @brief Enum para as estratégias de seleção de pais disponíveis
+ */
+enum class SelectionType {
+    HYBRID, // Ciclo de elitismo (os dois melhores) e sorteio uniforme
+    TOURNAMENT, // Melhor entre k indivíduos sorteados
+    STOCHASTIC_UNIVERSAL, // Amostragem universal estocástica proporcional ao fitness
+    RANK // Roleta sobre o ranking linear dos indivíduos
+};
+
+/**
+ * @brief Operador de cruzamento com os dados da instância que ele precisa, calculados uma única vez
+ */
+struct CrossoverOperator {
+    CrossoverType type = CrossoverType::ORDERED; // Operador selecionado
+    std::vector<std::vector<int>> candidates; // Listas de candidatos (EAX)
+    bool symmetric = true; // Indica se a matriz de pesos é simétrica (o EAX exige simetria)
+};
+
+/**
+ * @brief Enum para as formas de aproveitar o resultado da busca local no algoritmo memético
+ */
+enum class WriteBackType {
+    LAMARCKIAN, // O filho é substituído pelo ótimo local
+    BALDWINIAN // O filho mantém seu caminho e recebe apenas o custo do ótimo local
+};
+
+/**
+ * @brief Política de busca local aplicada aos filhos do algoritmo memético
+ */
+struct LocalSearchPolicy {
+    LocalSearchMethod method = LocalSearchMethod::SWAP; // Método de modificação
+    ImprovementType improvement = ImprovementType::FIRST_IMPROVEMENT; // Estratégia de melhoria
+    double threshold_percent = LOCAL_SEARCH_THRESHOLD_PERCENT; // Filtro pelo custo em relação à melhor solução
+    LocalSearchBudget budget = {LOCAL_SEARCH_MAX_MOVES, LOCAL_SEARCH_MAX_MS}; // Orçamento de cada busca
+    WriteBackType write_back = WriteBackType::LAMARCKIAN; // Forma de aproveitar o ótimo local
+};
+
+/**
+ * @brief Parâmetros do algoritmo genético, com os valores das constantes como padrão
+ */
+struct GeneticParameters {
+    size_t population_size = POPULATION_SIZE; // Tamanho da população
+    int max_iterations = MAX_ITERATIONS_NUMBER; // Número máximo de iterações
+    double mutation_percent = MUTATION_PERCENT; // Probabilidade de mutação de cada filho
+    int selection_cycle = SELECTION_CYCLE; // Iterações de um ciclo de seleção
+    int random_selections = RANDOM_SELECTIONS; // Seleções aleatórias por ciclo (as demais são elitistas)
+    CrossoverType crossover = CrossoverType::ORDERED; // Operador de cruzamento
+    SelectionType selection = SelectionType::HYBRID; // Estratégia de seleção de pais
+    int tournament_size = TOURNAMENT_SIZE; // Tamanho do torneio
+    size_t offspring_batch = OFFSPRING_BATCH_SIZE; // Filhos por geração (algoritmo memético)
+    int threads = MEMETIC_THREADS; // Threads da busca local dos filhos (algoritmo memético)
+    LocalSearchPolicy local_search_policy; // Busca local dos filhos (algoritmo memético)
+    unsigned int seed = 0; // Semente do gerador da thread que executa a busca (0 mantém o gerador atual)
+};
+
+/**
+ * @brief Prepara o operador de cruzamento para uma instância
+ * @param type O operador de cruzamento
+ * @param weights A matriz de pesos
+ * @return O operador pronto para ser aplicado
+ */
+CrossoverOperator make_crossover_operator(CrossoverType type, const std::vector<std::vector<double>>& weights) {
+    CrossoverOperator crossover_operator;
+    crossover_operator.type = type;
+
+    if (type == CrossoverType::EAX) {
+        crossover_operator.symmetric = is_symmetric(weights);
+        crossover_operator.candidates = build_candidate_lists(weights, EAX_CANDIDATES);
+    }
+
+    return crossover_operator;
+}
 
 /**
  * @brief Estrutura que armazena um indivíduo da população, com a solução "path referente a ele", seu custo e fitness
+ *
+ * O hash identifica o ciclo independentemente da rotação e do sentido (0 enquanto não calculado).
  */
 struct Individual {
   std::vector<int> path;
   double cost;
   double fitness;
+  uint64_t hash = 0;
 };
 
+/**
+ * @brief Buffers reutilizados entre as iterações para que a geração de filhos não aloque memória
+ *
+ * Os marcadores do crossover usam um carimbo de geração: um nó está marcado quando seu marcador é igual
+ * à geração atual, então desmarcar todos os nós é apenas incrementar a geração.
+ */
+struct OffspringWorkspace {
+    std::vector<int> child; // Caminho do filho em construção
+    std::vector<unsigned> marker; // Geração em que cada nó foi marcado
+    unsigned generation = 0; // Geração atual dos marcadores
+    std::vector<int> first_parent; // Cópias dos pais para os operadores que exigem std::vector (GPX e EAX)
+    std::vector<int> second_parent;
+    std::vector<size_t> leaderboard; // Índices dos indivíduos ordenados na renovação
+    std::vector<size_t> replaced; // Posições da população substituídas desde a última consulta do seletor
+    std::vector<const int*> batch_paths; // Caminhos dos filhos avaliados em lote
+    std::vector<double> batch_costs; // Custos calculados em lote
+    std::unordered_map<uint64_t, int> census; // Quantidade de indivíduos com cada hash na população renovada
+    const Individual* census_population = nullptr; // População à qual a contagem pertence
+    size_t census_size = 0; // Tamanho da população quando a contagem foi construída
+
+    /**
+     * @brief Desmarca todos os nós, redimensionando os marcadores para a ordem da instância
+     * @param order O número de nós
+     */
+    void clear_markers(size_t order) {
+        if (marker.size() != order || ++generation == 0) {
+            marker.assign(order, 0);
+            generation = 1;
+        }
+    }
+};
+
+/**
+ * @brief Retorna o gerador de números aleatórios da thread atual
+ *
+ * Cada thread possui seu próprio gerador, de forma que os operadores genéticos possam ser executados
+ * em paralelo (como no modelo de ilhas) sem disputar o estado global de std::rand.
+ *
+ * @return O gerador da thread atual
+ */
+std::mt19937& random_engine() {
+    thread_local std::mt19937 engine{std::random_device{}()};
+    return engine;
+}
+
+/**
+ * @brief Sorteia um inteiro uniformemente no intervalo [0, limit)
+ * @param limit O limite superior (exclusivo), maior que zero
+ * @return O inteiro sorteado
+ */
+int random_index(int limit) {
+    return std::uniform_int_distribution<int>(0, limit - 1)(random_engine());
+}
+
+/**
+ * @brief Sorteia um número real uniformemente no intervalo [0, 1)
+ * @return O número sorteado
+ */
+double random_probability() {
+    return std::uniform_real_distribution<double>(0.0, 1.0)(random_engine());
+}
+
 /**
  * @brief Gera uma solução aleatória
  * @param order Ordem do grafo a ser considerado, ou seja, número de nós da solução gerada
@@ -41,7 +214,7 @@ std::vector<int> generate_random_path(size_t order) {
     }
 
     // Embaralha a lista
-    std::shuffle(path.begin(), path.end(), std::mt19937{std::random_device{}()});
+    std::shuffle(path.begin(), path.end(), random_engine());
 
     return path;
 }
@@ -50,11 +223,12 @@ std::vector<int> generate_random_path(size_t order) {
  * @brief Gera a população inicial do algoritmo genético
  * @param graph Grafo que o algoritmo está utilizando
  * @param weights Matriz de pesos do grafo utilizado
+ * @param population_size Número de indivíduos da população
  * @return Vetor de indivíduos representando a população inicial
  */
 template<typename Node>
 std::vector<Individual> generate_population(const IGraph<Node>& graph,
-    const std::vector<std::vector<double>>& weights) {
+    const std::vector<std::vector<double>>& weights, size_t population_size = POPULATION_SIZE) {
 
     std::vector<Individual> population;
 
@@ -66,7 +240,7 @@ std::vector<Individual> generate_population(const IGraph<Node>& graph,
     population.push_back({nearest_neighbor_result, -1, -1});
 
     // Preenche o restante da população com soluções aleatórias
-    for (size_t i = 2; i < POPULATION_SIZE; i++) {
+    for (size_t i = 2; i < population_size; i++) {
         std::vector<int> random_path = generate_random_path(graph.get_order());
         population.push_back({random_path, -1, -1});
     }
@@ -74,28 +248,86 @@ std::vector<Individual> generate_population(const IGraph<Node>& graph,
     return population;
 }
 
+/**
+ * @brief Preenche e avalia a população inicial diretamente na arena
+ *
+ * Usa as mesmas soluções de generate_population: inserção mais barata, vizinho mais próximo e caminhos
+ * aleatórios.
+ *
+ * @param population A arena da população
+ * @param graph Grafo que o algoritmo está utilizando
+ * @param weights Matriz de pesos do grafo utilizado
+ * @param flat A mesma matriz de pesos, plana, usada na avaliação em lote
+ */
+template<typename Index, typename Node>
+void fill_population(PopulationArena<Index>& population, const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights, const FlatWeights& flat) {
+
+    for (size_t slot = 0; slot < population.size(); slot++) {
+        std::vector<int> path;
+        if (slot == 0) {
+            path = cheapest_insertion(graph, weights, graph.get_node(0));
+        } else if (slot == 1) {
+            path = nearest_neighbor(graph, weights, graph.get_node(0));
+        } else {
+            path = generate_random_path(graph.get_order());
+        }
+
+        population.store(slot, path, tour_hash(path));
+    }
+
+    population.evaluate(0, population.size(), flat);
+}
+
 /**
  * @brief Calcula o custo e o fitness de cada indivíduo da população
  * @param population População utilizada pelo algoritmo a ser atualizada
- * @param weights Matriz de pesos do grafo utilizado
+ * @param weights Matriz de pesos plana, construída uma vez por execução
  */
-void calculate_fitness(std::vector<Individual>& population,
-    const std::vector<std::vector<double>>& weights) {
+void calculate_fitness(std::vector<Individual>& population, const FlatWeights& weights) {
 
-    // Para cada indivíduo, calcula seu custo e depois seu fitness como sendo o inverso do custo
-    for (auto& item : population) {
-        item.cost = calculate_path_cost(weights, item.path);
-        item.fitness = 1 / item.cost;
+    if (population.empty()) {
+        return;
     }
+
+    // Os custos de toda a população são calculados em lote sobre a matriz plana
+    std::vector<const int*> paths;
+    paths.reserve(population.size());
+    for (const auto& item : population) {
+        paths.push_back(item.path.data());
+    }
+    std::vector<double> costs;
+    calculate_path_costs(weights, paths, population[0].path.size(), costs);
+
+    // Para cada indivíduo, o fitness é o inverso do custo
+    for (size_t i = 0; i < population.size(); i++) {
+        population[i].cost = costs[i];
+        population[i].fitness = 1 / costs[i];
+        population[i].hash = tour_hash(population[i].path);
+    }
+}
+
+/**
+ * @brief Retorna o fitness de um indivíduo da população
+ */
+double individual_fitness(const std::vector<Individual>& population, size_t index) {
+    return population[index].fitness;
+}
+
+template<typename Index>
+double individual_fitness(const PopulationArena<Index>& population, size_t index) {
+    return population.fitness(index);
 }
 
 /**
  * @brief Seleciona os dois indivíduos com melhor fitness para serem pais
+ * @tparam Population Um std::vector<Individual> ou uma PopulationArena
  * @param population População para se pegar os dois indivíduos
  * @param last_parents Par com índices dos dois últimos pais selecionados por essa função, para não repetí-los 2 vezes seguidas
  * @return Par com índices dos dois indivíduos de melhor fitness que são diferentes dos dois em last_parents
  */
-std::pair<int, int> select_best_parents(const std::vector<Individual>& population, std::pair<int, int> last_parents) {
+template<typename Population>
+std::pair<int, int> select_best_parents(const Population& population, std::pair<int, int> last_parents) {
     int first_better = -1, second_better = -1;
 
     // Para cada indivíduo que não foi um dos dois últimos pais selecionados
@@ -105,13 +337,13 @@ std::pair<int, int> select_best_parents(const std::vector<Individual>& populatio
         }
 
         // Verifica primeiramente se é melhor que o primeiro melhor encontrado até então
-        if (first_better == -1 || population[i].fitness > population[first_better].fitness) {
+        if (first_better == -1 || individual_fitness(population, i) > individual_fitness(population, first_better)) {
             // Se sim, atualiza o primeiro e o segundo melhores
             second_better = first_better;
             first_better = i;
         }
         // Se não, verifica se é melhor que o segundo melhor encontrado até então
-        else if (second_better == -1 || population[i].fitness > population[second_better].fitness) {
+        else if (second_better == -1 || individual_fitness(population, i) > individual_fitness(population, second_better)) {
             // Se sim, atualiza o segundo melhor
             second_better = i;
         }
@@ -126,11 +358,12 @@ std::pair<int, int> select_best_parents(const std::vector<Individual>& populatio
  * @param population População para se pegar os dois indivíduos
  * @return Par com os índices de dois indivíduos aleatórios e distintos
  */
-std::pair<int, int> select_random_parents(const std::vector<Individual>& population) {
+template<typename Population>
+std::pair<int, int> select_random_parents(const Population& population) {
     // Seleciona aleatoriamente o índice do primeiro indivíduo
-    int first_parent = std::rand() % population.size();
+    int first_parent = random_index(population.size());
     // Seleciona aleatoriamente o índice segundo indivíduo de forma que não seja igual ao primeiro
-    int second_parent = (first_parent + std::rand() % (population.size() - 1) + 1) % population.size();
+    int second_parent = (first_parent + random_index(population.size() - 1) + 1) % population.size();
 
     // Retorna um par com os índices dos dois indivíduos aleatórios
     return std::make_pair(first_parent, second_parent);
@@ -141,13 +374,17 @@ std::pair<int, int> select_random_parents(const std::vector<Individual>& populat
  * @param population População para se pegar os dois indivíduos
  * @param iteration_count Contagem de iterações do algoritmo
  * @param last_parents Par com os índices dos últimos dois pais selecionados por elitismo
+ * @param selection_cycle Número de iterações de um ciclo de seleção
+ * @param random_selections Quantas iterações do ciclo usam a seleção aleatória
  * @return Par com índices dos pais escolhidos, através do elitismo ou da aleatoriedade dependendo da iteração
  */
-std::pair<int, int> select_parents(const std::vector<Individual>& population, int iteration_count,
-    std::pair<int, int>& last_parents) {
+template<typename Population>
+std::pair<int, int> select_parents(const Population& population, int iteration_count,
+    std::pair<int, int>& last_parents, int selection_cycle = SELECTION_CYCLE,
+    int random_selections = RANDOM_SELECTIONS) {
 
-    // A cada 4 iterações, em 3 a seleção é feita pelo elitismo e em uma a seleção é aleatória
-    if (iteration_count % 4 == 3) {
+    // As últimas iterações de cada ciclo usam a seleção aleatória e as demais o elitismo
+    if (iteration_count % selection_cycle >= selection_cycle - random_selections) {
         return select_random_parents(population);
     } else {
         last_parents = select_best_parents(population, last_parents);
@@ -156,33 +393,296 @@ std::pair<int, int> select_parents(const std::vector<Individual>& population, in
     }
 }
 
+/**
+ * @class ParentSelector
+ * @brief Seleciona pais com a estratégia configurada, mantendo as estruturas auxiliares entre as iterações
+ *
+ * O torneio custa O(k) por pai. A amostragem universal estocástica usa uma árvore de Fenwick sobre o
+ * fitness, e o ranking usa uma tabela de alias sobre as posições do ranking (que só depende do tamanho
+ * da população, então é montada uma única vez) e a ordem dos indivíduos por fitness. Ambas são
+ * atualizadas apenas nas posições informadas em update(), sem percorrer a população inteira.
+ */
+class ParentSelector {
+    private:
+        SelectionType type;
+        int tournament_size;
+        int selection_cycle;
+        int random_selections;
+
+        // Amostragem universal estocástica: árvore de Fenwick com o fitness de cada posição
+        std::vector<double> tree;
+        std::vector<double> values;
+        double total;
+        size_t pending_updates;
+
+        // Ranking: posições ordenadas do maior para o menor fitness, e tabela de alias sobre o ranking
+        std::vector<size_t> ranking;
+        std::vector<size_t> rank_of;
+        std::vector<double> alias_probability;
+        std::vector<size_t> alias;
+
+        void build_tree() {
+            size_t size = values.size();
+            tree.assign(size + 1, 0.0);
+            total = 0.0;
+            for (size_t i = 1; i <= size; i++) {
+                tree[i] += values[i - 1];
+                total += values[i - 1];
+                size_t parent = i + (i & (~i + 1));
+                if (parent <= size) {
+                    tree[parent] += tree[i];
+                }
+            }
+            pending_updates = 0;
+        }
+
+        void add_to_tree(size_t position, double delta) {
+            for (size_t i = position + 1; i < tree.size(); i += i & (~i + 1)) {
+                tree[i] += delta;
+            }
+            total += delta;
+        }
+
+        // Retorna a posição em que a soma acumulada do fitness ultrapassa target
+        size_t find_in_tree(double target) const {
+            size_t size = values.size();
+            size_t position = 0;
+            size_t step = 1;
+            while (step * 2 <= size) {
+                step *= 2;
+            }
+            for (; step > 0; step /= 2) {
+                if (position + step <= size && tree[position + step] <= target) {
+                    position += step;
+                    target -= tree[position];
+                }
+            }
+            return std::min(position, size - 1);
+        }
+
+        // Monta a tabela de alias (método de Vose) dos pesos do ranking linear
+        void build_alias_table(size_t size) {
+            double pressure = RANK_SELECTION_PRESSURE;
+            std::vector<double> scaled(size);
+            for (size_t rank = 0; rank < size; rank++) {
+                double weight = size > 1 ?
+                    (pressure - 2.0 * (pressure - 1.0) * rank / (size - 1)) / size : 1.0;
+                scaled[rank] = weight * size;
+            }
+
+            alias_probability.assign(size, 1.0);
+            alias.resize(size);
+            std::vector<size_t> small, large;
+            for (size_t rank = 0; rank < size; rank++) {
+                alias[rank] = rank;
+                (scaled[rank] < 1.0 ? small : large).push_back(rank);
+            }
+
+            while (!small.empty() && !large.empty()) {
+                size_t less = small.back();
+                size_t more = large.back();
+                small.pop_back();
+                alias_probability[less] = scaled[less];
+                alias[less] = more;
+                scaled[more] -= 1.0 - scaled[less];
+                if (scaled[more] < 1.0) {
+                    large.pop_back();
+                    small.push_back(more);
+                }
+            }
+        }
+
+        // Move a posição para o seu lugar no ranking após uma mudança de fitness
+        void reposition(size_t position) {
+            size_t rank = rank_of[position];
+            double fitness = values[position];
+
+            while (rank > 0 && values[ranking[rank - 1]] < fitness) {
+                ranking[rank] = ranking[rank - 1];
+                rank_of[ranking[rank]] = rank;
+                rank--;
+            }
+            while (rank + 1 < ranking.size() && values[ranking[rank + 1]] > fitness) {
+                ranking[rank] = ranking[rank + 1];
+                rank_of[ranking[rank]] = rank;
+                rank++;
+            }
+            ranking[rank] = position;
+            rank_of[position] = rank;
+        }
+
+        template<typename Population>
+        int tournament(const Population& population) const {
+            int best = random_index(population.size());
+            for (int round = 1; round < tournament_size; round++) {
+                int candidate = random_index(population.size());
+                if (individual_fitness(population, candidate) > individual_fitness(population, best)) {
+                    best = candidate;
+                }
+            }
+            return best;
+        }
+
+        int rank_sample() const {
+            size_t rank = random_index(ranking.size());
+            if (random_probability() >= alias_probability[rank]) {
+                rank = alias[rank];
+            }
+            return ranking[rank];
+        }
+
+        // Garante pais distintos, sorteando outro segundo pai se necessário
+        static std::pair<int, int> distinct(int first_parent, int second_parent, size_t population_size) {
+            if (first_parent == second_parent) {
+                second_parent = (first_parent + random_index(population_size - 1) + 1) % population_size;
+            }
+            return std::make_pair(first_parent, second_parent);
+        }
+
+    public:
+        /**
+         * @brief Cria o seletor com os parâmetros do algoritmo genético
+         * @param type A estratégia de seleção
+         * @param tournament_size O tamanho do torneio
+         * @param selection_cycle As iterações de um ciclo da seleção híbrida
+         * @param random_selections As seleções aleatórias por ciclo da seleção híbrida
+         */
+        ParentSelector(SelectionType type = SelectionType::HYBRID, int tournament_size = TOURNAMENT_SIZE,
+            int selection_cycle = SELECTION_CYCLE, int random_selections = RANDOM_SELECTIONS)
+            : type(type), tournament_size(std::max(1, tournament_size)), selection_cycle(selection_cycle),
+              random_selections(random_selections), total(0.0), pending_updates(0) {}
+
+        explicit ParentSelector(const GeneticParameters& params)
+            : ParentSelector(params.selection, params.tournament_size, params.selection_cycle,
+                             params.random_selections) {}
+
+        /**
+         * @brief Monta as estruturas auxiliares para a população inteira
+         * @param population A população
+         */
+        template<typename Population>
+        void reset(const Population& population) {
+            if (type != SelectionType::STOCHASTIC_UNIVERSAL && type != SelectionType::RANK) {
+                return;
+            }
+
+            size_t size = population.size();
+            values.resize(size);
+            for (size_t i = 0; i < size; i++) {
+                values[i] = individual_fitness(population, i);
+            }
+
+            if (type == SelectionType::STOCHASTIC_UNIVERSAL) {
+                build_tree();
+            } else {
+                ranking.resize(size);
+                for (size_t i = 0; i < size; i++) {
+                    ranking[i] = i;
+                }
+                std::sort(ranking.begin(), ranking.end(),
+                    [this](size_t a, size_t b) { return values[a] > values[b]; });
+                rank_of.resize(size);
+                for (size_t rank = 0; rank < size; rank++) {
+                    rank_of[ranking[rank]] = rank;
+                }
+                if (alias.size() != size) {
+                    build_alias_table(size);
+                }
+            }
+        }
+
+        /**
+         * @brief Atualiza as estruturas auxiliares nas posições cujo indivíduo mudou
+         * @param population A população
+         * @param changed As posições alteradas (podem se repetir)
+         */
+        template<typename Population>
+        void update(const Population& population, const std::vector<size_t>& changed) {
+            if (type != SelectionType::STOCHASTIC_UNIVERSAL && type != SelectionType::RANK) {
+                return;
+            }
+
+            for (size_t position : changed) {
+                double fitness = individual_fitness(population, position);
+                double delta = fitness - values[position];
+                values[position] = fitness;
+
+                if (type == SelectionType::STOCHASTIC_UNIVERSAL) {
+                    add_to_tree(position, delta);
+                    pending_updates++;
+                } else {
+                    reposition(position);
+                }
+            }
+
+            // Reconstrói a árvore periodicamente para que os erros de arredondamento não se acumulem
+            if (type == SelectionType::STOCHASTIC_UNIVERSAL && pending_updates >= values.size()) {
+                build_tree();
+            }
+        }
+
+        /**
+         * @brief Seleciona dois pais distintos
+         * @param population A população, com pelo menos dois indivíduos
+         * @param iteration_count Contagem de iterações do algoritmo (usada pela seleção híbrida)
+         * @param last_parents Os últimos pais escolhidos pelo elitismo (usados pela seleção híbrida)
+         * @return Par com os índices dos pais
+         */
+        template<typename Population>
+        std::pair<int, int> select(const Population& population, int iteration_count,
+            std::pair<int, int>& last_parents) const {
+
+            switch (type) {
+                case SelectionType::TOURNAMENT:
+                    return distinct(tournament(population), tournament(population), population.size());
+                case SelectionType::STOCHASTIC_UNIVERSAL: {
+                    // Dois ponteiros igualmente espaçados sobre a roleta do fitness
+                    double spacing = total / 2.0;
+                    double start = random_probability() * spacing;
+                    return distinct(find_in_tree(start), find_in_tree(start + spacing), population.size());
+                }
+                case SelectionType::RANK:
+                    return distinct(rank_sample(), rank_sample(), population.size());
+                default:
+                    return select_parents(population, iteration_count, last_parents, selection_cycle,
+                                          random_selections);
+            }
+        }
+};
+
 /**
  * @brief Realiza o crossover ordenado entre dois pais para gerar um filho
- * @param first_parent O primeiro pai
- * @param second_parent O segundo pai
- * @param rng O gerador de números aleatórios
- * @return O caminho do filho gerado pelo crossover
+ * @tparam Tour Um std::vector<int> ou uma TourView da arena
+ * @param first_parent O caminho do primeiro pai
+ * @param second_parent O caminho do segundo pai
+ * @param path O caminho do filho, sobrescrito (a capacidade já reservada é reaproveitada)
+ * @param workspace Os buffers reutilizados, de onde vêm os marcadores dos nós inseridos
  */
-std::vector<int> ordered_crossover(const Individual& first_parent, const Individual& second_parent) {
-    int total_nodes = first_parent.path.size();
-    std::vector<int> path(total_nodes, -1);
+template<typename Tour>
+void ordered_crossover(const Tour& first_parent, const Tour& second_parent, std::vector<int>& path,
+    OffspringWorkspace& workspace) {
+
+    int total_nodes = first_parent.size();
+    path.assign(total_nodes, -1);
 
     // Pontos de corte aleatórios
-    int start_index = std::rand() % total_nodes;
-    int end_index = std::rand() % total_nodes;
+    int start_index = random_index(total_nodes);
+    int end_index = random_index(total_nodes);
 
     if (start_index > end_index) {
         std::swap(start_index, end_index);
     }
 
-    // Mapeia para rastrear quais nós já foram inseridos no filho
-    std::vector<bool> is_node_inserted(total_nodes, false);
+    // Marcadores para rastrear quais nós já foram inseridos no filho
+    workspace.clear_markers(total_nodes);
+    std::vector<unsigned>& marker = workspace.marker;
+    unsigned inserted = workspace.generation;
 
     // copia fatia
     for (int i = start_index; i <= end_index; ++i) {
-        int node = first_parent.path[i];
+        int node = first_parent[i];
         path[i] = node;
-        is_node_inserted[node] = true;
+        marker[node] = inserted;
     }
 
     // Indica onde começar a preencher o restante do filho
@@ -190,60 +690,138 @@ std::vector<int> ordered_crossover(const Individual& first_parent, const Individ
     int current_index_offspring = (end_index + 1) % total_nodes;
 
     while (current_index_offspring != start_index) {
-        int candidate_node = second_parent.path[current_index_second_parent];
+        int candidate_node = second_parent[current_index_second_parent];
 
         // Verifica se o nó já foi inserido
-        if (!is_node_inserted[candidate_node]) {
+        if (marker[candidate_node] != inserted) {
             path[current_index_offspring] = candidate_node;
-            is_node_inserted[candidate_node] = true;
+            marker[candidate_node] = inserted;
 
             current_index_offspring = (current_index_offspring + 1) % total_nodes;
         }
 
         current_index_second_parent = (current_index_second_parent + 1) % total_nodes;
     }
+}
 
+template<typename Tour>
+std::vector<int> ordered_crossover(const Tour& first_parent, const Tour& second_parent) {
+    std::vector<int> path;
+    OffspringWorkspace workspace;
+    ordered_crossover(first_parent, second_parent, path, workspace);
     return path;
 }
 
+std::vector<int> ordered_crossover(const Individual& first_parent, const Individual& second_parent) {
+    return ordered_crossover(first_parent.path, second_parent.path);
+}
+
+/**
+ * @brief Aplica o operador de cruzamento selecionado entre dois pais
+ *
+ * GPX e EAX não geram nada novo quando os pais não têm partições recombináveis ou são iguais (e o EAX
+ * exige uma matriz simétrica); nesses casos o crossover ordenado é usado para não gerar um clone.
+ *
+ * @param crossover_operator O operador de cruzamento
+ * @param first_parent O caminho do primeiro pai
+ * @param second_parent O caminho do segundo pai
+ * @param weights A matriz de pesos, utilizada por GPX e EAX para escolher as arestas
+ * @param path O caminho do filho, sobrescrito
+ * @param workspace Os buffers reutilizados
+ */
+void crossover(const CrossoverOperator& crossover_operator, const std::vector<int>& first_parent,
+    const std::vector<int>& second_parent, const std::vector<std::vector<double>>& weights,
+    std::vector<int>& path, OffspringWorkspace& workspace) {
+
+    if (crossover_operator.type == CrossoverType::GPX) {
+        path = partition_crossover(first_parent, second_parent, weights);
+    } else if (crossover_operator.type == CrossoverType::EAX && crossover_operator.symmetric) {
+        path = edge_assembly_crossover(first_parent, second_parent, weights,
+                                       crossover_operator.candidates, random_engine());
+    } else {
+        path.clear();
+    }
+
+    if (!path.empty() && path != first_parent) {
+        return;
+    }
+
+    ordered_crossover(first_parent, second_parent, path, workspace);
+}
+
+/**
+ * @brief Aplica o operador de cruzamento selecionado entre dois caminhos da arena
+ *
+ * O crossover ordenado lê os pais diretamente da arena; GPX e EAX recebem cópias dos pais nos buffers
+ * do workspace.
+ */
+template<typename Index>
+void crossover(const CrossoverOperator& crossover_operator, const TourView<Index>& first_parent,
+    const TourView<Index>& second_parent, const std::vector<std::vector<double>>& weights,
+    std::vector<int>& path, OffspringWorkspace& workspace) {
+
+    if (crossover_operator.type == CrossoverType::ORDERED ||
+        (crossover_operator.type == CrossoverType::EAX && !crossover_operator.symmetric)) {
+        ordered_crossover(first_parent, second_parent, path, workspace);
+        return;
+    }
+
+    workspace.first_parent.assign(first_parent.begin(), first_parent.end());
+    workspace.second_parent.assign(second_parent.begin(), second_parent.end());
+    crossover(crossover_operator, workspace.first_parent, workspace.second_parent, weights, path, workspace);
+}
+
 /**
  * @brief Realiza a mutação por troca entre dois genes
+ *
+ * Apenas as arestas vizinhas às duas posições mudam, então o hash é atualizado com elas.
+ *
  * @param individual O indivíduo a ser mutado
+ * @param hash O hash do indivíduo, atualizado incrementalmente
 */
-void mutation_swap(std::vector<int>& individual) {
+void mutation_swap(std::vector<int>& individual, uint64_t& hash) {
     int size = individual.size();
 
-    int first_index = std::rand() % size;
-    int second_index = std::rand() % size;
+    int first_index = random_index(size);
+    int second_index = random_index(size);
 
+    hash ^= edges_hash(individual, {first_index - 1, first_index, second_index - 1, second_index});
     std::swap(individual[first_index], individual[second_index]);
+    hash ^= edges_hash(individual, {first_index - 1, first_index, second_index - 1, second_index});
 }
 
 /**
  * @brief Realiza a mutação por inversão de um trecho
+ *
+ * As arestas internas ao trecho apenas mudam de sentido, então só as duas arestas das bordas alteram o hash.
+ *
  * @param individual O indivíduo a ser mutado
+ * @param hash O hash do indivíduo, atualizado incrementalmente
  */
-void mutation_inversion(std::vector<int>& individual) {
+void mutation_inversion(std::vector<int>& individual, uint64_t& hash) {
     int size = individual.size();
 
-    int first_random_index = std::rand() % size;
-    int second_random_index = std::rand() % size;
+    int first_random_index = random_index(size);
+    int second_random_index = random_index(size);
 
     int start = std::min(first_random_index, second_random_index);
     int end = std::max(first_random_index, second_random_index);
 
+    hash ^= edges_hash(individual, {start - 1, end});
     std::reverse(individual.begin() + start, individual.begin() + end + 1);
+    hash ^= edges_hash(individual, {start - 1, end});
 }
 
 /**
  * @brief Realiza a mutação por embaralhamento de um trecho
  * @param individual O indivíduo a ser mutado
+ * @param hash O hash do indivíduo, atualizado com as arestas do trecho e das suas bordas
  */
-void mutation_scramble(std::vector<int>& individual) {
+void mutation_scramble(std::vector<int>& individual, uint64_t& hash) {
     int size = individual.size();
 
-    int first_random_index = std::rand() % size;
-    int second_random_index = std::rand() % size;
+    int first_random_index = random_index(size);
+    int second_random_index = random_index(size);
 
     int start = std::min(first_random_index, second_random_index);
     int end = std::max(first_random_index, second_random_index);
@@ -251,149 +829,273 @@ void mutation_scramble(std::vector<int>& individual) {
     int range_size = end - start;
 
     if (range_size > 0) {
+        hash ^= range_edges_hash(individual, start - 1, end);
+
         for(int i = 0; i < range_size; i++) {
             // Sorteia dois offsets dentro do intervalo e troca os elementos correspondentes
-            int offset_a = std::rand() % (range_size + 1);
-            int offset_b = std::rand() % (range_size + 1);
+            int offset_a = random_index(range_size + 1);
+            int offset_b = random_index(range_size + 1);
 
             std::swap(individual[start + offset_a], individual[start + offset_b]);
         }
+
+        hash ^= range_edges_hash(individual, start - 1, end);
     }
 }
 
 /**
- * @brief Aplica mutação em um indivíduo com base na taxa de mutação
- * @param individual O indivíduo a ser mutado
+ * @brief Aplica mutação em um caminho com base na taxa de mutação
+ * @param path O caminho a ser mutado
+ * @param hash O hash do caminho, atualizado pela mutação
  * @param mutation_rate A taxa de mutação (entre 0.0 e 1.0)
  */
-void apply_mutation(Individual& individual, double mutation_rate) {
+void apply_mutation(std::vector<int>& path, uint64_t& hash, double mutation_rate) {
 
-    double random_chance = (double)std::rand() / RAND_MAX;
+    double random_chance = random_probability();
 
     if (random_chance < mutation_rate) {
         // Sorteia um número entre 0 e 2 para decidir o tipo
-        int mutation_type = std::rand() % 3;
+        int mutation_type = random_index(3);
 
         switch (mutation_type) {
             case 0:
-                mutation_swap(individual.path);
+                mutation_swap(path, hash);
                 break;
             case 1:
-                mutation_inversion(individual.path);
+                mutation_inversion(path, hash);
                 break;
             case 2:
-                mutation_scramble(individual.path);
+                mutation_scramble(path, hash);
                 break;
         }
     }
 }
 
 /**
- * @brief Aplica elitismo copiando o melhor indivíduo da população atual para a próxima geração
- * @param current_population A população atual
- * @param offsprings Os filhos gerados para a próxima geração
- * @param weights A matriz de pesos para cálculo do custo
- * @return A nova população após aplicar o elitismo
+ * @brief Aplica mutação em um indivíduo com base na taxa de mutação
+ * @param individual O indivíduo a ser mutado, cujo hash já deve estar calculado
+ * @param mutation_rate A taxa de mutação (entre 0.0 e 1.0)
+ */
+void apply_mutation(Individual& individual, double mutation_rate) {
+    apply_mutation(individual.path, individual.hash, mutation_rate);
+}
+
+/**
+ * @brief Aplica elitismo substituindo os piores indivíduos da população pelos filhos
+ *
+ * Filhos cujo ciclo já está na população (ou que repetem um filho anterior) são descartados pelo hash,
+ * para que a população não se encha de clones. A contagem dos hashes da população fica no workspace e é
+ * atualizada a cada substituição, então cada filho é verificado em O(1); ela só é reconstruída quando o
+ * workspace passa a renovar outra população. A substituição troca o conteúdo do indivíduo com o do
+ * filho, de forma que o caminho substituído volta para o vetor de filhos e seu buffer é reaproveitado na
+ * próxima geração.
+ *
+ * @param population A população, renovada no próprio vetor
+ * @param offsprings Os filhos gerados; ao final contêm os indivíduos descartados
+ * @param workspace Os buffers reutilizados, onde as posições substituídas são acrescentadas a replaced
  */
-std::vector<Individual> renovation_elitism(
-    const std::vector<Individual> current_population,
-    const std::vector<Individual>& offsprings,
-    const std::vector<std::vector<double>>& weights
-) {
-    // Copia da população atual
-    std::vector<Individual> new_population = current_population;
+void renovation_elitism(std::vector<Individual>& population, std::vector<Individual>& offsprings,
+    OffspringWorkspace& workspace) {
 
-    // Criamos uma tabela para ordenar os indivíduos pelo custo
-    std::vector<std::pair<double, int>> leaderboard;
+    size_t population_size = population.size();
+    size_t replacements = std::min(offsprings.size(), population_size);
 
-    for (int i = 0; i < new_population.size(); ++i) {
-        leaderboard.push_back({new_population[i].cost, i});
+    // Tabela com os índices dos indivíduos, dos piores para os melhores
+    std::vector<size_t>& leaderboard = workspace.leaderboard;
+    leaderboard.resize(population_size);
+    for (size_t i = 0; i < population_size; ++i) {
+        leaderboard[i] = i;
+    }
+    std::partial_sort(leaderboard.begin(), leaderboard.begin() + replacements, leaderboard.end(),
+        [&population](size_t a, size_t b) { return population[a].cost > population[b].cost; });
+
+    // Contagem dos ciclos presentes na população, mantida entre as gerações
+    std::unordered_map<uint64_t, int>& census = workspace.census;
+    if (workspace.census_population != population.data() || workspace.census_size != population_size) {
+        census.clear();
+        for (auto& individual : population) {
+            if (individual.hash == 0) {
+                individual.hash = tour_hash(individual.path);
+            }
+            census[individual.hash]++;
+        }
+        workspace.census_population = population.data();
+        workspace.census_size = population_size;
     }
 
-    // Ordena do menor para o maior custo
-    std::sort(leaderboard.begin(), leaderboard.end());
+    // Substitui os piores indivíduos pelos filhos gerados que ainda não estão na população
+    size_t replaced = 0;
+    for (size_t i = 0; i < offsprings.size() && replaced < replacements; ++i) {
+        Individual& offspring = offsprings[i];
+        if (offspring.hash == 0) {
+            offspring.hash = tour_hash(offspring.path);
+        }
 
-    int num_children = offsprings.size();
-    int population_size = new_population.size();
+        if (census.count(offspring.hash) > 0) {
+            continue;
+        }
 
-    // Substitui os piores indivíduos pelos filhos gerados
-    for (int i = 0; i < num_children; ++i) {
+        // Pegamos o índice do pior indivíduo e subtituímos pelo filho
+        Individual& worst = population[leaderboard[replaced]];
+        auto entry = census.find(worst.hash);
+        if (entry != census.end() && --entry->second <= 0) {
+            census.erase(entry);
+        }
+        census[offspring.hash]++;
+        std::swap(worst, offspring);
+        workspace.replaced.push_back(leaderboard[replaced]);
+        replaced++;
+    }
+}
 
-        if (i < population_size) {
+/**
+ * @brief Substitui os piores indivíduos da arena pelos filhos montados nas vagas reservas
+ *
+ * Equivale a renovation_elitism: o i-ésimo filho aceito ocupa a vaga do i-ésimo pior indivíduo, e filhos
+ * cujo ciclo já está na população são descartados. A substituição é uma troca de vagas, sem cópia.
+ *
+ * @param population A arena da população
+ * @param offspring_count O número de filhos, guardados a partir da vaga population.size()
+ * @param workspace Os buffers reutilizados, onde as vagas substituídas são acrescentadas a replaced
+ */
+template<typename Index>
+void renovation_elitism(PopulationArena<Index>& population, size_t offspring_count,
+    OffspringWorkspace& workspace) {
+
+    size_t population_size = population.size();
+    size_t replacements = std::min(offspring_count, population_size);
+
+    // Os índices dos piores indivíduos, do pior para o melhor
+    std::vector<size_t>& leaderboard = workspace.leaderboard;
+    leaderboard.resize(population_size);
+    for (size_t i = 0; i < population_size; i++) {
+        leaderboard[i] = i;
+    }
+    std::partial_sort(leaderboard.begin(), leaderboard.begin() + replacements, leaderboard.end(),
+        [&population](size_t a, size_t b) { return population.cost(a) > population.cost(b); });
 
-            // Pegamos o índice do pior indivíduo e subtituímos pelo filho
-            int worst_index = leaderboard[population_size - 1 - i].second;
-            new_population[worst_index] = offsprings[i];
+    size_t replaced = 0;
+    for (size_t i = 0; i < offspring_count && replaced < replacements; i++) {
+        size_t offspring = population_size + i;
+        if (population.contains(population.hash(offspring))) {
+            continue;
         }
-    }
 
-    return new_population;
+        population.swap_slots(leaderboard[replaced], offspring);
+        workspace.replaced.push_back(leaderboard[replaced]);
+        replaced++;
+    }
 }
 
 /**
- * @brief Função que executa o algoritmo genético
+ * @brief Executa o algoritmo genético sobre uma população guardada em uma PopulationArena
+ * @tparam Index O tipo inteiro em que os nós são guardados
  * @param graph Grafo para ser executado o algoritmo
  * @param weights Matriz de peso do grafo
+ * @param params Parâmetros do algoritmo
+ * @param monitor O acompanhamento da busca
  * @return Melhor solução encontrada durante toda a execução do algoritmo
  */
-template<typename Node>
-std::vector<int> genetic_search(const IGraph<Node>& graph,
-    const std::vector<std::vector<double>>& weights) {
+template<typename Index, typename Node>
+std::vector<int> evolve_population(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weights,
+    const GeneticParameters& params, SolverMonitor& monitor) {
 
-    std::srand(std::time(nullptr));
+    CrossoverOperator crossover_operator = make_crossover_operator(params.crossover, weights);
+    OffspringWorkspace workspace;
+    std::vector<int>& path = workspace.child;
 
-    // Gera e calcula o fitness da população inicial
-    std::vector<Individual> population = generate_population(graph, weights);
-    calculate_fitness(population, weights);
+    // Matriz plana para a avaliação em lote, construída uma única vez
+    FlatWeights flat = flatten_weights(weights);
 
-    // Declara a melhor solução atual como sendo a primeira
-    Individual best_solution = population[0];
+    // Gera e calcula o fitness da população inicial, com duas vagas reservas para os filhos
+    PopulationArena<Index> population(params.population_size, graph.get_order(), 2);
+    fill_population(population, graph, weights, flat);
+
+    ParentSelector selector(params);
+    selector.reset(population);
+
+    // Declara a melhor solução atual como sendo a melhor da população inicial
+    size_t best_slot = 0;
+    for (size_t slot = 1; slot < population.size(); slot++) {
+        if (population.cost(slot) < population.cost(best_slot)) {
+            best_slot = slot;
+        }
+    }
+    std::vector<int> best_path = population.path(best_slot);
+    double best_cost = population.cost(best_slot);
+
+    monitor.improve(best_path, best_cost);
 
     // Variável utilizada para armazenar os últimos pais a serem selecionados pelo elitismo
     std::pair<int, int> last_parents = {-1, -1};
 
-    for (int i = 0; i < MAX_ITERATIONS_NUMBER; i++) {
-        // Seleção por elitismo ou aleatoriedade
-        std::pair<int, int> parents = select_parents(population, i, last_parents);
+    for (int i = 0; i < params.max_iterations && !monitor.should_stop(); i++) {
+        // Seleção com a estratégia configurada
+        std::pair<int, int> parents = selector.select(population, i, last_parents);
 
-        // Cruzamento por crossover
-        std::vector<int> path1 = ordered_crossover(population[parents.first], population[parents.second]);
-        Individual child1 = {path1, -1, -1};
+        // Cruzamento e mutação de cada filho, montado no buffer reutilizado e gravado em uma vaga reserva
+        for (int child = 0; child < 2; child++) {
+            int first = child == 0 ? parents.first : parents.second;
+            int second = child == 0 ? parents.second : parents.first;
 
-        std::vector<int> path2 = ordered_crossover(population[parents.second], population[parents.first]);
-        Individual child2 = {path2, -1, -1};
+            crossover(crossover_operator, population.tour(first), population.tour(second), weights, path, workspace);
+            uint64_t hash = tour_hash(path);
+            apply_mutation(path, hash, params.mutation_percent);
 
-        // Mutação com taxa de 50%
-        apply_mutation(child1, MUTATION_PERCENT);
-        apply_mutation(child2, MUTATION_PERCENT);
+            population.store(population.size() + child, path, hash);
+        }
 
-        // Cálculo do fitness dos filhos
-        child1.cost = calculate_path_cost(weights, child1.path);
-        child2.cost = calculate_path_cost(weights, child2.path);
-        child1.fitness = 1 / child1.cost;
-        child2.fitness = 1 / child2.cost;
+        // Os dois filhos são avaliados em lote
+        population.evaluate(population.size(), 2, flat);
 
-        std::vector<Individual> offsprings = {child1, child2};
+        // Um filho melhor que a melhor solução sempre entra na população
+        for (size_t slot = population.size(); slot < population.size() + 2; slot++) {
+            if (population.cost(slot) < best_cost) {
+                best_path = population.path(slot);
+                best_cost = population.cost(slot);
+                monitor.improve(best_path, best_cost);
+            }
+        }
 
         // Renovação da população com elitismo
-        population = renovation_elitism(population, offsprings, weights);
+        workspace.replaced.clear();
+        renovation_elitism(population, 2, workspace);
+        selector.update(population, workspace.replaced);
 
-        int best_index = 0;
+        monitor.iteration();
+    }
 
-        // Verificação de qual a melhor solução da população
-        for (int i = 1; i < population.size(); i++) {
-            if (population[i].cost < population[best_index].cost) {
-                best_index = i;
-            }
-        }
+    return best_path;
+}
 
-        // Verificação se foi encontrada uma melhor solução do que a melhor até então
-        if (population[best_index].cost < best_solution.cost) {
-            best_solution = population[best_index];
-        }
+/**
+ * @brief Função que executa o algoritmo genético
+ *
+ * A população é guardada em uma PopulationArena, com os nós em 16 bits quando a instância permite.
+ *
+ * @param graph Grafo para ser executado o algoritmo
+ * @param weights Matriz de peso do grafo
+ * @param params Parâmetros do algoritmo (população, iterações, mutação, seleção e cruzamento)
+ * @param control Critérios de parada e callback de melhora
+ * @return Melhor solução encontrada durante toda a execução do algoritmo
+ */
+template<typename Node>
+std::vector<int> genetic_search(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights, const GeneticParameters& params = GeneticParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+
+    if (params.seed != 0) {
+        random_engine().seed(params.seed);
     }
 
-    return best_solution.path;
+    std::vector<int> best_path = PopulationArena<uint16_t>::fits(graph.get_order()) ?
+        evolve_population<uint16_t>(graph, weights, params, monitor) :
+        evolve_population<uint32_t>(graph, weights, params, monitor);
+
+    monitor.finish();
+    return best_path;
 }
 
 #endif
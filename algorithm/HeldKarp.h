@@ -0,0 +1,269 @@
+#ifndef HELD_KARP_H
+#define HELD_KARP_H
+
+#include <vector>
+#include <limits>
+#include <thread>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/ThreadPool.h"
+
+// Maior número de nós aceito pelo Held-Karp (a tabela ocupa 8 * 2^(n-1) * (n-1) bytes)
+#define HELD_KARP_MAX_NODES 24
+// Número de nós a partir do qual as camadas da programação dinâmica são divididas entre threads
+#define HELD_KARP_PARALLEL_NODES 16
+// Conjuntos percorridos por cada thread entre duas verificações do tempo limite e do cancelamento
+#define HELD_KARP_CONTROL_INTERVAL 4096
+
+/**
+ * @brief Retorna o próximo conjunto com o mesmo número de bits em ordem numérica (Gosper)
+ * @param mask O conjunto atual
+ * @return O menor conjunto maior que mask com a mesma cardinalidade
+ */
+uint32_t next_subset(uint32_t mask) {
+    uint32_t lowest = mask & -mask;
+    uint32_t ripple = mask + lowest;
+    return (((ripple ^ mask) >> 2) / lowest) | ripple;
+}
+
+/**
+ * @brief Retorna o conjunto de k bits na posição rank da ordem numérica crescente desses conjuntos
+ *
+ * Pelo sistema combinatório de numeração, o bit mais alto é o maior b com C(b, k) <= rank, e os demais
+ * formam o conjunto de k - 1 bits na posição rank - C(b, k).
+ *
+ * @param binomial A tabela de coeficientes binomiais, binomial[n][k] = C(n, k)
+ * @param k O número de bits do conjunto
+ * @param rank A posição do conjunto
+ * @return O conjunto
+ */
+uint32_t unrank_subset(const std::vector<std::vector<uint64_t>>& binomial, int k, uint64_t rank) {
+    uint32_t mask = 0;
+    for (; k > 0; k--) {
+        int bit = k - 1;
+        while (bit + 1 < (int)binomial.size() && binomial[bit + 1][k] <= rank) {
+            bit++;
+        }
+        mask |= 1u << bit;
+        rank -= binomial[bit][k];
+    }
+    return mask;
+}
+
+/**
+ * @brief Resolve o problema do caixeiro viajante de forma exata pela programação dinâmica de Held-Karp
+ *
+ * O nó 0 é fixado como início, e cost[mask][j] guarda o menor custo de um caminho que sai de 0, visita
+ * exatamente os nós do conjunto mask (bits dos nós 1..n-1) e termina em j. A tabela é um único vetor
+ * contíguo em que as n-1 entradas de um mesmo conjunto ficam lado a lado, e os conjuntos de uma mesma
+ * cardinalidade dependem apenas da camada anterior. Cada camada enumera apenas os seus conjuntos, em
+ * ordem crescente pelo método de Gosper, e é dividida em intervalos contínuos entre as threads de um
+ * WorkStealingPool criado uma vez por execução. O caminho é reconstruído recalculando o melhor
+ * predecessor, sem tabela de pais.
+ *
+ * O tempo limite e o cancelamento do controle são verificados durante o preenchimento da tabela. Como a
+ * programação dinâmica só produz um caminho ao final, uma execução interrompida retorna um resultado sem
+ * caminho, com custo infinito; solve_tsp usa então a busca local iterada no tempo restante.
+ *
+ * @param weights A matriz de pesos
+ * @param threads O número de threads (0 utiliza uma por núcleo disponível)
+ * @param control O tempo limite, o cancelamento e o callback, que recebe o caminho ótimo
+ * @return O caminho ótimo começando no nó 0 e seu custo, que também é o limitante inferior
+ */
+TSPResult held_karp(const std::vector<std::vector<double>>& weights, int threads = 0,
+    const SolverControl& control = SolverControl()) {
+    auto start_time = std::chrono::steady_clock::now();
+    auto elapsed_ms = [&start_time]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    };
+    int order = weights.size();
+
+    if (order > HELD_KARP_MAX_NODES) {
+        throw std::invalid_argument("Held-Karp supports at most " + std::to_string(HELD_KARP_MAX_NODES) + " nodes");
+    }
+
+    TSPResult result;
+
+    if (order <= 3) {
+        for (int node = 0; node < order; node++) {
+            result.path.push_back(node);
+        }
+        double forward = 0.0, backward = 0.0;
+        for (int node = 0; order > 1 && node < order; node++) {
+            forward += weights[node][(node + 1) % order];
+            backward += weights[(node + 1) % order][node];
+        }
+        // Com três nós só existem os dois sentidos do ciclo
+        if (backward < forward) {
+            std::reverse(result.path.begin() + 1, result.path.end());
+        }
+        result.cost = std::min(forward, backward);
+        result.lower_bound = result.cost;
+        report_result(control, result, elapsed_ms());
+        return result;
+    }
+
+    // Nós 1..n-1 são representados pelos bits 0..m-1
+    int m = order - 1;
+    uint32_t subsets = 1u << m;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Cópia plana da matriz de pesos
+    std::vector<double> distance(order * order);
+    for (int i = 0; i < order; i++) {
+        for (int j = 0; j < order; j++) {
+            distance[i * order + j] = weights[i][j];
+        }
+    }
+
+    // Toda entrada lida (bits i e j contidos no conjunto) é escrita antes, então a tabela não é
+    // inicializada e suas páginas só são tocadas quando preenchidas
+    std::unique_ptr<double[]> cost(new double[(size_t)subsets * m]);
+
+    for (int j = 0; j < m; j++) {
+        cost[((size_t)1 << j) * m + j] = distance[j + 1];
+    }
+
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (order < HELD_KARP_PARALLEL_NODES) {
+        threads = 1;
+    }
+
+    // Coeficientes binomiais C(n, k) para 0 <= k <= n <= m: quantidade de conjuntos de cada camada
+    std::vector<std::vector<uint64_t>> binomial(m + 1, std::vector<uint64_t>(m + 1, 0));
+    for (int n = 0; n <= m; n++) {
+        binomial[n][0] = 1;
+        for (int k = 1; k <= n; k++) {
+            binomial[n][k] = binomial[n - 1][k - 1] + (k < n ? binomial[n - 1][k] : 0);
+        }
+    }
+
+    // Interrupção cooperativa, compartilhada entre as threads de uma camada
+    std::atomic<bool> interrupted(false);
+    auto should_stop = [&]() {
+        if (interrupted.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        if (control_expired(control, elapsed_ms())) {
+            interrupted.store(true, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    };
+
+    // Calcula os conjuntos de posições [first, last) de uma camada, em ordem crescente
+    auto process_range = [&](int layer, uint64_t first, uint64_t last) {
+        // Cópias locais para que o compilador não as releia a cada escrita na tabela
+        double* table = cost.get();
+        const double* edges = distance.data();
+        const int size = m;
+        const int stride = order;
+
+        uint32_t mask = unrank_subset(binomial, layer, first);
+        for (uint64_t rank = first; rank < last; rank++, mask = next_subset(mask)) {
+            if ((rank - first + 1) % HELD_KARP_CONTROL_INTERVAL == 0 && should_stop()) {
+                return;
+            }
+            double* row = table + (size_t)mask * size;
+
+            for (int j = 0; j < size; j++) {
+                if (!(mask & (1u << j))) {
+                    continue;
+                }
+                uint32_t previous = mask ^ (1u << j);
+                const double* previous_row = table + (size_t)previous * size;
+                double best = infinity;
+
+                for (int i = 0; i < size; i++) {
+                    if (previous & (1u << i)) {
+                        best = std::min(best, previous_row[i] + edges[(i + 1) * stride + j + 1]);
+                    }
+                }
+                row[j] = best;
+            }
+        }
+    };
+
+    // Threads persistentes entre as camadas; a thread chamadora assume o primeiro intervalo de cada uma
+    std::unique_ptr<WorkStealingPool> pool;
+    if (threads > 1) {
+        pool = std::make_unique<WorkStealingPool>(threads - 1);
+    }
+
+    for (int layer = 2; layer <= m && !should_stop(); layer++) {
+        uint64_t count = binomial[m][layer];
+        if (!pool) {
+            process_range(layer, 0, count);
+        } else {
+            pool->run_batch(threads, [&](size_t t) {
+                process_range(layer, count * t / threads, count * (t + 1) / threads);
+            });
+        }
+    }
+
+    // Sem a tabela completa não há caminho para reconstruir
+    if (interrupted.load(std::memory_order_relaxed)) {
+        result.cost = infinity;
+        return result;
+    }
+
+    // Fecha o ciclo voltando ao nó 0
+    uint32_t full = subsets - 1;
+    int last = 0;
+    result.cost = infinity;
+    for (int j = 0; j < m; j++) {
+        double total = cost[(size_t)full * m + j] + distance[(j + 1) * order];
+        if (total < result.cost) {
+            result.cost = total;
+            last = j;
+        }
+    }
+
+    // Reconstrói o caminho de trás para frente escolhendo o melhor predecessor de cada estado
+    std::vector<int> reversed_path;
+    uint32_t mask = full;
+    int current = last;
+    while (true) {
+        reversed_path.push_back(current + 1);
+        uint32_t previous = mask ^ (1u << current);
+        if (previous == 0) {
+            break;
+        }
+
+        int best_previous = -1;
+        double best = infinity;
+        for (int i = 0; i < m; i++) {
+            if (previous & (1u << i)) {
+                double candidate = cost[(size_t)previous * m + i] + distance[(i + 1) * order + current + 1];
+                if (best_previous == -1 || candidate < best) {
+                    best = candidate;
+                    best_previous = i;
+                }
+            }
+        }
+
+        mask = previous;
+        current = best_previous;
+    }
+
+    result.path.push_back(0);
+    result.path.insert(result.path.end(), reversed_path.rbegin(), reversed_path.rend());
+    // O custo é ótimo, então é também o limitante inferior
+    result.lower_bound = result.cost;
+
+    report_result(control, result, elapsed_ms());
+    return result;
+}
+
+#endif
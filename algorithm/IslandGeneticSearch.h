@@ -0,0 +1,298 @@
+#ifndef ISLAND_GENETIC_SEARCH_H
+#define ISLAND_GENETIC_SEARCH_H
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "GeneticSearch.h"
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/LockFreeQueue.h"
+#include "../utils/TSPUtils.h"
+
+// Número de ilhas (0 utiliza uma ilha por núcleo disponível)
+#define ISLANDS_NUMBER 0
+// Tamanho da população de cada ilha
+#define ISLAND_POPULATION_SIZE 125
+// Intervalo, em iterações, entre os envios de migrantes
+#define MIGRATION_INTERVAL 100
+// Quantidade de melhores indivíduos enviados a cada migração
+#define MIGRANTS_NUMBER 2
+// Capacidade de cada fila de migração
+#define MIGRATION_QUEUE_CAPACITY 16
+
+/**
+ * @brief Enum para as topologias de migração entre as ilhas
+ */
+enum class MigrationTopology {
+    RING,
+    FULLY_CONNECTED
+};
+
+/**
+ * @brief Parâmetros do algoritmo genético em ilhas
+ *
+ * Os operadores de cada ilha (cruzamento, mutação e seleção) vêm de genetic; o tamanho da população e o
+ * número de iterações de genetic são ignorados em favor dos campos próprios de cada ilha.
+ */
+struct IslandParameters {
+    int islands = ISLANDS_NUMBER; // Número de ilhas (0 utiliza uma por núcleo)
+    size_t population_size = ISLAND_POPULATION_SIZE; // Tamanho da população de cada ilha
+    int iterations = MAX_ITERATIONS_NUMBER; // Iterações executadas por cada ilha
+    int migration_interval = MIGRATION_INTERVAL; // Iterações entre migrações
+    int migrants = MIGRANTS_NUMBER; // Indivíduos enviados por migração
+    MigrationTopology topology = MigrationTopology::RING; // Topologia de migração
+    GeneticParameters genetic; // Operadores do algoritmo genético aplicados em cada ilha
+};
+
+/**
+ * @brief Canais de migração de uma ilha: filas de chegada e de saída
+ *
+ * Cada par (origem, destino) possui sua própria fila, de forma que toda fila tem exatamente um
+ * produtor e um consumidor e pode ser acessada sem travas.
+ */
+struct IslandChannels {
+    std::vector<SpscQueue<Individual>*> incoming;
+    std::vector<SpscQueue<Individual>*> outgoing;
+};
+
+/**
+ * @brief Envia cópias dos melhores indivíduos da ilha para as ilhas vizinhas
+ *
+ * Se a fila de um vizinho estiver cheia, os migrantes são descartados em vez de bloquear a ilha.
+ *
+ * @param population A população da ilha
+ * @param channels Os canais de migração da ilha
+ * @param migrants O número de indivíduos enviados
+ */
+template<typename Index>
+void send_migrants(const PopulationArena<Index>& population, IslandChannels& channels, int migrants) {
+    std::vector<int> order(population.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+
+    int count = std::min<int>(migrants, population.size());
+    std::partial_sort(order.begin(), order.begin() + count, order.end(),
+        [&](int a, int b) { return population.cost(a) < population.cost(b); });
+
+    for (int k = 0; k < count; k++) {
+        Individual migrant = {population.path(order[k]), population.cost(order[k]),
+                              population.fitness(order[k]), population.hash(order[k])};
+        for (auto* queue : channels.outgoing) {
+            queue->try_push(migrant);
+        }
+    }
+}
+
+/**
+ * @brief Recebe os migrantes disponíveis, que substituem os piores indivíduos da ilha
+ *
+ * Os migrantes são gravados nas vagas reservas da arena, avaliados em lote e entram na população em lotes
+ * do tamanho delas.
+ *
+ * @param population A população da ilha
+ * @param channels Os canais de migração da ilha
+ * @param weights A matriz de pesos plana
+ * @param workspace Os buffers reutilizados da ilha
+ */
+template<typename Index>
+void receive_migrants(PopulationArena<Index>& population, IslandChannels& channels,
+    const FlatWeights& weights, OffspringWorkspace& workspace) {
+
+    size_t spare_slots = population.slots() - population.size();
+    size_t received = 0;
+    Individual immigrant;
+
+    for (auto* queue : channels.incoming) {
+        while (queue->try_pop(immigrant)) {
+            size_t slot = population.size() + received;
+            population.store(slot, immigrant.path, immigrant.hash != 0 ? immigrant.hash : tour_hash(immigrant.path));
+
+            if (++received == spare_slots) {
+                population.evaluate(population.size(), received, weights);
+                renovation_elitism(population, received, workspace);
+                received = 0;
+            }
+        }
+    }
+
+    if (received > 0) {
+        population.evaluate(population.size(), received, weights);
+        renovation_elitism(population, received, workspace);
+    }
+}
+
+/**
+ * @brief Evolui a população de uma ilha, trocando migrantes de forma assíncrona com as vizinhas
+ * @param graph O grafo
+ * @param weights A matriz de pesos
+ * @param flat A mesma matriz de pesos, plana e compartilhada entre as ilhas
+ * @param crossover_operator O operador de cruzamento, compartilhado entre as ilhas
+ * @param params Os parâmetros do modelo de ilhas
+ * @param channels Os canais de migração da ilha
+ * @param monitor O acompanhamento compartilhado entre as ilhas
+ * @return O melhor indivíduo encontrado pela ilha
+ */
+template<typename Index, typename Node>
+Individual evolve_island(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weights,
+    const FlatWeights& flat, const CrossoverOperator& crossover_operator, const IslandParameters& params,
+    IslandChannels& channels, SolverMonitor& monitor) {
+
+    // Vagas reservas para os dois filhos ou para um lote de migrantes
+    PopulationArena<Index> population(params.population_size, graph.get_order(),
+                                      std::max<size_t>(2, params.migrants));
+    fill_population(population, graph, weights, flat);
+
+    OffspringWorkspace workspace;
+    std::vector<int>& path = workspace.child;
+
+    ParentSelector selector(params.genetic);
+    selector.reset(population);
+
+    size_t best_slot = 0;
+    for (size_t slot = 1; slot < population.size(); slot++) {
+        if (population.cost(slot) < population.cost(best_slot)) {
+            best_slot = slot;
+        }
+    }
+    Individual best_solution = {population.path(best_slot), population.cost(best_slot),
+                                population.fitness(best_slot), population.hash(best_slot)};
+    std::pair<int, int> last_parents = {-1, -1};
+    monitor.improve(best_solution.path, best_solution.cost);
+
+    for (int i = 0; i < params.iterations && !monitor.should_stop(); i++) {
+        // Seleção, cruzamento e mutação com os operadores do algoritmo genético
+        std::pair<int, int> parents = selector.select(population, i, last_parents);
+
+        for (int child = 0; child < 2; child++) {
+            int first = child == 0 ? parents.first : parents.second;
+            int second = child == 0 ? parents.second : parents.first;
+
+            crossover(crossover_operator, population.tour(first), population.tour(second), weights, path, workspace);
+            uint64_t hash = tour_hash(path);
+            apply_mutation(path, hash, params.genetic.mutation_percent);
+
+            population.store(population.size() + child, path, hash);
+        }
+        population.evaluate(population.size(), 2, flat);
+
+        workspace.replaced.clear();
+        renovation_elitism(population, 2, workspace);
+
+        // Migração assíncrona: a ilha nunca espera pelas vizinhas
+        if (params.migration_interval > 0 && i % params.migration_interval == params.migration_interval - 1) {
+            send_migrants(population, channels, params.migrants);
+        }
+        receive_migrants(population, channels, flat, workspace);
+        selector.update(population, workspace.replaced);
+
+        // Só as vagas substituídas por filhos ou migrantes podem conter uma solução melhor
+        bool improved = false;
+        for (size_t slot : workspace.replaced) {
+            if (population.cost(slot) < best_solution.cost) {
+                best_solution = {population.path(slot), population.cost(slot), population.fitness(slot),
+                                 population.hash(slot)};
+                improved = true;
+            }
+        }
+
+        if (improved) {
+            monitor.improve(best_solution.path, best_solution.cost);
+        }
+        monitor.iteration();
+    }
+
+    return best_solution;
+}
+
+/**
+ * @brief Executa o algoritmo genético em ilhas, cada uma em sua própria thread
+ *
+ * Cada ilha evolui uma subpopulação com os operadores do algoritmo genético e, periodicamente, envia
+ * seus melhores indivíduos às ilhas vizinhas por filas sem travas, segundo a topologia escolhida. A
+ * subpopulação de cada ilha é guardada em uma PopulationArena. Com params.genetic.seed não nulo, a ilha i
+ * usa a semente seed + i; como as migrações são assíncronas, só uma execução com uma única ilha é
+ * exatamente reproduzível.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param params Os parâmetros do modelo de ilhas
+ * @param control Os critérios de parada e o callback de melhora; a estagnação soma as iterações das ilhas
+ * @return O melhor caminho encontrado entre todas as ilhas, seu custo e o limitante inferior da instância
+ */
+template<typename Node>
+TSPResult island_genetic_search(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights,
+    const IslandParameters& params = IslandParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+
+    int islands = params.islands;
+    if (islands <= 0) {
+        islands = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Cria uma fila para cada ligação (origem, destino) da topologia
+    std::vector<std::unique_ptr<SpscQueue<Individual>>> queues;
+    std::vector<IslandChannels> channels(islands);
+
+    auto connect = [&](int from, int to) {
+        queues.push_back(std::make_unique<SpscQueue<Individual>>(MIGRATION_QUEUE_CAPACITY));
+        channels[from].outgoing.push_back(queues.back().get());
+        channels[to].incoming.push_back(queues.back().get());
+    };
+
+    for (int from = 0; from < islands && islands > 1; from++) {
+        if (params.topology == MigrationTopology::RING) {
+            connect(from, (from + 1) % islands);
+        } else {
+            for (int to = 0; to < islands; to++) {
+                if (to != from) {
+                    connect(from, to);
+                }
+            }
+        }
+    }
+
+    // Matriz plana da avaliação em lote, construída uma vez e compartilhada entre as ilhas
+    FlatWeights flat = flatten_weights(weights);
+    CrossoverOperator crossover_operator = make_crossover_operator(params.genetic.crossover, weights);
+
+    std::vector<Individual> island_best(islands);
+    std::vector<std::thread> threads;
+
+    for (int island = 0; island < islands; island++) {
+        threads.emplace_back([&, island]() {
+            if (params.genetic.seed != 0) {
+                random_engine().seed(params.genetic.seed + island);
+            }
+            island_best[island] = PopulationArena<uint16_t>::fits(graph.get_order()) ?
+                evolve_island<uint16_t>(graph, weights, flat, crossover_operator, params, channels[island], monitor) :
+                evolve_island<uint32_t>(graph, weights, flat, crossover_operator, params, channels[island], monitor);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Redução: o melhor indivíduo entre as ilhas
+    auto best = std::min_element(island_best.begin(), island_best.end(),
+        [](const Individual& a, const Individual& b) { return a.cost < b.cost; });
+
+    TSPResult result;
+    result.path = best->path;
+    result.cost = best->cost;
+    result.lower_bound = monitor.lower_bound();
+    monitor.finish();
+    return result;
+}
+
+#endif
@@ -0,0 +1,359 @@
+#ifndef ITERATED_LOCAL_SEARCH_H
+#define ITERATED_LOCAL_SEARCH_H
+
+#include <vector>
+#include <deque>
+#include <random>
+#include <algorithm>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "NearestNeighbor.h"
+#include "LocalSearch.h"
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/TSPUtils.h"
+
+// Número máximo de perturbações realizadas pela busca local iterada
+#define ILS_MAX_ITERATIONS 10000
+// Quantidade de inversões aleatórias aplicadas pela perturbação por inversão de trechos
+#define ILS_SEGMENT_REVERSALS 3
+
+/**
+ * @brief Enum para os tipos de perturbação aplicados pela busca local iterada
+ */
+enum class KickType {
+    DOUBLE_BRIDGE,
+    SEGMENT_REVERSAL
+};
+
+/**
+ * @brief Enum para os critérios de aceitação de um novo ótimo local
+ */
+enum class AcceptanceCriterion {
+    BETTER,
+    BETTER_OR_EQUAL,
+    RANDOM_WALK
+};
+
+/**
+ * @brief Parâmetros da busca local iterada
+ */
+struct IteratedLocalSearchParameters {
+    KickType kick = KickType::DOUBLE_BRIDGE; // Tipo de perturbação
+    AcceptanceCriterion acceptance = AcceptanceCriterion::BETTER_OR_EQUAL; // Critério de aceitação dos novos ótimos locais
+    int max_iterations = ILS_MAX_ITERATIONS; // Número máximo de perturbações
+    unsigned int seed = 0; // Semente do gerador (0 sorteia uma semente)
+};
+
+/**
+ * @brief Estado da reotimização local: posições dos nós e fila de nós "sujos" (don't look bits)
+ */
+struct LocalOptimizationState {
+    std::vector<int> position; // Posição de cada nó no caminho
+    std::vector<bool> queued; // Indica se o nó está na fila de reavaliação
+    std::deque<int> queue; // Nós cujas arestas mudaram e precisam ser reavaliados
+};
+
+/**
+ * @brief Marca um nó como sujo, colocando-o na fila de reavaliação
+ * @param state O estado da reotimização local
+ * @param node O nó a ser marcado
+ */
+void mark_dirty(LocalOptimizationState& state, int node) {
+    if (!state.queued[node]) {
+        state.queued[node] = true;
+        state.queue.push_back(node);
+    }
+}
+
+/**
+ * @brief Aplica um movimento 2-opt removendo as arestas nas posições first_edge e second_edge
+ * @param path O caminho a ser modificado
+ * @param state O estado da reotimização local, com as posições atualizadas pelo movimento
+ * @param first_edge A posição da primeira aresta (aresta k liga path[k] a path[k + 1])
+ * @param second_edge A posição da segunda aresta (first_edge < second_edge)
+ */
+void apply_two_opt(std::vector<int>& path, LocalOptimizationState& state,
+    size_t first_edge, size_t second_edge) {
+
+    size_t path_size = path.size();
+
+    apply_invert(path, first_edge + 1, second_edge);
+
+    // Atualiza apenas as posições do trecho invertido
+    for (size_t k = first_edge + 1; k <= second_edge; k++) {
+        state.position[path[k]] = k;
+    }
+
+    // As extremidades das arestas trocadas voltam a ser avaliadas
+    mark_dirty(state, path[first_edge]);
+    mark_dirty(state, path[first_edge + 1]);
+    mark_dirty(state, path[second_edge]);
+    mark_dirty(state, path[(second_edge + 1) % path_size]);
+}
+
+/**
+ * @brief Executa o 2-opt apenas a partir dos nós sujos até que a fila se esvazie
+ *
+ * Cada nó retirado da fila testa as inversões que removem uma das suas duas arestas, com variação de
+ * custo calculada em O(1). Assim, após uma perturbação, apenas a vizinhança das arestas alteradas é
+ * reotimizada em vez de o caminho inteiro ser percorrido novamente.
+ *
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho a ser otimizado
+ * @param cost O custo do caminho, atualizado a cada melhoria
+ * @param state O estado da reotimização local com os nós sujos
+ * @param symmetric Indica se a matriz de pesos é simétrica
+ */
+void optimize_dirty_nodes(const std::vector<std::vector<double>>& weights, std::vector<int>& path,
+    double& cost, LocalOptimizationState& state, bool symmetric) {
+
+    size_t path_size = path.size();
+
+    if (path_size < 4) {
+        state.queue.clear();
+        std::fill(state.queued.begin(), state.queued.end(), false);
+        return;
+    }
+
+    while (!state.queue.empty()) {
+        int node = state.queue.front();
+        state.queue.pop_front();
+        state.queued[node] = false;
+
+        size_t node_position = state.position[node];
+        // Arestas incidentes ao nó: a que chega nele e a que sai dele
+        size_t node_edges[2] = {(node_position + path_size - 1) % path_size, node_position};
+        bool improved = false;
+
+        for (size_t edge : node_edges) {
+            for (size_t other = 0; other < path_size && !improved; other++) {
+                size_t first_edge = std::min(edge, other);
+                size_t second_edge = std::max(edge, other);
+
+                // Arestas adjacentes não geram um novo caminho
+                if (second_edge - first_edge < 2 || (first_edge == 0 && second_edge == path_size - 1)) {
+                    continue;
+                }
+
+                double delta = invert_delta(weights, path, first_edge + 1, second_edge, symmetric);
+
+                if (delta < -IMPROVEMENT_EPSILON) {
+                    apply_two_opt(path, state, first_edge, second_edge);
+                    cost += delta;
+                    improved = true;
+                }
+            }
+
+            if (improved) {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Aplica a perturbação double-bridge, reconectando o caminho na ordem A C B D
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho a ser perturbado
+ * @param state O estado da reotimização local, que recebe as extremidades alteradas como nós sujos
+ * @param rng O gerador de números aleatórios
+ * @return A variação de custo da perturbação, calculada pelas três arestas trocadas
+ */
+double double_bridge_kick(const std::vector<std::vector<double>>& weights, std::vector<int>& path,
+    LocalOptimizationState& state, std::mt19937& rng) {
+    size_t path_size = path.size();
+
+    // Sorteia três pontos de corte distintos 0 < a < b < c < n
+    std::uniform_int_distribution<size_t> cut_distribution(1, path_size - 1);
+    size_t cuts[3];
+    do {
+        cuts[0] = cut_distribution(rng);
+        cuts[1] = cut_distribution(rng);
+        cuts[2] = cut_distribution(rng);
+        std::sort(cuts, cuts + 3);
+    } while (cuts[0] == cuts[1] || cuts[1] == cuts[2]);
+
+    // Os trechos mantêm o sentido, então só as arestas A-B, B-C e C-D dão lugar a A-C, C-B e B-D
+    int a_end = path[cuts[0] - 1];
+    int b_start = path[cuts[0]];
+    int b_end = path[cuts[1] - 1];
+    int c_start = path[cuts[1]];
+    int c_end = path[cuts[2] - 1];
+    int d_start = path[cuts[2] % path_size];
+    double delta = weights[a_end][c_start] + weights[c_end][b_start] + weights[b_end][d_start]
+                 - weights[a_end][b_start] - weights[b_end][c_start] - weights[c_end][d_start];
+
+    // Troca os trechos B = [a, b) e C = [b, c) de lugar
+    std::rotate(path.begin() + cuts[0], path.begin() + cuts[1], path.begin() + cuts[2]);
+
+    for (size_t k = cuts[0]; k < cuts[2]; k++) {
+        state.position[path[k]] = k;
+    }
+
+    // Extremidades das três arestas novas
+    size_t c_length = cuts[2] - cuts[1];
+    size_t touched[6] = {cuts[0] - 1, cuts[0], cuts[0] + c_length - 1, cuts[0] + c_length,
+                         cuts[2] - 1, cuts[2] % path_size};
+    for (size_t k : touched) {
+        mark_dirty(state, path[k]);
+    }
+
+    return delta;
+}
+
+/**
+ * @brief Aplica a perturbação por inversão de alguns trechos curtos aleatórios
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho a ser perturbado
+ * @param state O estado da reotimização local, que recebe as extremidades alteradas como nós sujos
+ * @param rng O gerador de números aleatórios
+ * @param symmetric Indica se a matriz de pesos é simétrica
+ * @return A variação de custo da perturbação, somada inversão a inversão
+ */
+double segment_reversal_kick(const std::vector<std::vector<double>>& weights, std::vector<int>& path,
+    LocalOptimizationState& state, std::mt19937& rng, bool symmetric) {
+    size_t path_size = path.size();
+    double delta = 0.0;
+    size_t max_length = std::max<size_t>(2, path_size / 10);
+
+    std::uniform_int_distribution<size_t> start_distribution(0, path_size - 2);
+    std::uniform_int_distribution<size_t> length_distribution(1, max_length);
+
+    for (int r = 0; r < ILS_SEGMENT_REVERSALS; r++) {
+        size_t start = start_distribution(rng);
+        size_t end = std::min(path_size - 1, start + length_distribution(rng));
+
+        delta += invert_delta(weights, path, start, end, symmetric);
+        apply_invert(path, start, end);
+
+        for (size_t k = start; k <= end; k++) {
+            state.position[path[k]] = k;
+        }
+
+        mark_dirty(state, path[(start + path_size - 1) % path_size]);
+        mark_dirty(state, path[start]);
+        mark_dirty(state, path[end]);
+        mark_dirty(state, path[(end + 1) % path_size]);
+    }
+
+    return delta;
+}
+
+/**
+ * @brief Decide se o novo ótimo local substitui a solução corrente
+ * @param acceptance O critério de aceitação
+ * @param candidate_cost O custo do novo ótimo local
+ * @param current_cost O custo da solução corrente
+ * @return true se o candidato deve ser aceito
+ */
+bool accept_candidate(AcceptanceCriterion acceptance, double candidate_cost, double current_cost) {
+    switch (acceptance) {
+        case AcceptanceCriterion::BETTER:
+            return candidate_cost < current_cost - IMPROVEMENT_EPSILON;
+        case AcceptanceCriterion::BETTER_OR_EQUAL:
+            return candidate_cost <= current_cost + IMPROVEMENT_EPSILON;
+        case AcceptanceCriterion::RANDOM_WALK:
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Executa a busca local iterada (ILS) partindo do vizinho mais próximo
+ *
+ * A cada iteração a solução corrente é perturbada e apenas os nós próximos das arestas alteradas pela
+ * perturbação são reotimizados com 2-opt. O melhor caminho encontrado é mantido a qualquer momento,
+ * de forma que a busca pode ser interrompida a qualquer momento pelos critérios do controle.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param start_node O nó inicial da solução construtiva
+ * @param params A perturbação, o critério de aceitação, o número de perturbações e a semente
+ * @param control Os critérios de parada e o callback de melhora
+ * @return O melhor caminho encontrado, seu custo e o limitante inferior da instância
+ */
+template<typename Node>
+TSPResult iterated_local_search(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights, Node start_node,
+    const IteratedLocalSearchParameters& params = IteratedLocalSearchParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+    std::mt19937 rng(params.seed != 0 ? params.seed : std::random_device{}());
+    bool symmetric = is_symmetric(weights);
+
+    std::vector<int> current_path = nearest_neighbor(graph, weights, start_node);
+    size_t path_size = current_path.size();
+
+    LocalOptimizationState state;
+    state.position.assign(path_size, 0);
+    state.queued.assign(path_size, false);
+
+    for (size_t k = 0; k < path_size; k++) {
+        state.position[current_path[k]] = k;
+        mark_dirty(state, current_path[k]);
+    }
+
+    // A primeira otimização parte com todos os nós sujos
+    double current_cost = calculate_path_cost(weights, current_path);
+    optimize_dirty_nodes(weights, current_path, current_cost, state, symmetric);
+
+    TSPResult result;
+    result.path = current_path;
+    result.cost = current_cost;
+    result.lower_bound = monitor.lower_bound();
+    monitor.improve(result.path, result.cost);
+
+    // Caminhos pequenos demais não admitem perturbação
+    if (path_size < 8) {
+        monitor.finish();
+        return result;
+    }
+
+    std::vector<int> candidate_path = current_path;
+    LocalOptimizationState candidate_state = state;
+
+    for (int iteration = 0; iteration < params.max_iterations; iteration++) {
+        if (monitor.should_stop()) {
+            break;
+        }
+
+        // Perturbação seguida da reotimização local apenas das arestas alteradas; o candidato parte da
+        // solução corrente, então seu custo é o corrente mais a variação da perturbação
+        double candidate_cost = current_cost;
+        if (params.kick == KickType::DOUBLE_BRIDGE) {
+            candidate_cost += double_bridge_kick(weights, candidate_path, candidate_state, rng);
+        } else {
+            candidate_cost += segment_reversal_kick(weights, candidate_path, candidate_state, rng, symmetric);
+        }
+        optimize_dirty_nodes(weights, candidate_path, candidate_cost, candidate_state, symmetric);
+
+        if (candidate_cost < result.cost - IMPROVEMENT_EPSILON) {
+            result.path = candidate_path;
+            result.cost = candidate_cost;
+            monitor.improve(result.path, result.cost);
+        }
+        monitor.iteration();
+
+        // Aceita o candidato ou restaura a solução corrente
+        if (accept_candidate(params.acceptance, candidate_cost, current_cost)) {
+            current_path = candidate_path;
+            current_cost = candidate_cost;
+            state.position = candidate_state.position;
+        } else {
+            candidate_path = current_path;
+            candidate_state.position = state.position;
+        }
+    }
+
+    // Recalcula o custo final para eliminar o acúmulo de erros de arredondamento das variações
+    result.cost = calculate_path_cost(weights, result.path);
+    monitor.finish();
+
+    return result;
+}
+
+#endif
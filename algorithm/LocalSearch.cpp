@@ -1,10 +1,13 @@
 #include <vector>
 #include <algorithm>
 #include <utility>
+#include <chrono>
+#include <functional>
 
 #include "LocalSearch.h"
 #include "TSPResult.h"
 #include "../utils/TSPUtils.h"
+#include "../utils/ThreadPool.h"
 
 
 /**
@@ -55,9 +58,122 @@ void apply_invert(std::vector<int>& path, size_t i, size_t j) {
     }
 }
 
-/**
- * @brief Aplica o método de modificação selecionado no caminho
- */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost swap_delta(const std::vector<std::vector<Weight>>& weights,
+                                               const std::vector<int>& path, size_t i, size_t j) {
+    typedef typename WeightTraits<Weight>::Cost Cost;
+    size_t path_size = path.size();
+
+    if(i == j) {
+        return 0;
+    }
+
+    // Nó que ocupa a posição k após a troca
+    auto node_after = [&](size_t k) {
+        if(k == i) {
+            return path[j];
+        }
+        if(k == j) {
+            return path[i];
+        }
+        return path[k];
+    };
+
+    // Arestas que começam nas posições i - 1, i, j - 1 e j, sem repetição quando i e j são vizinhos
+    size_t edges[4] = {(i + path_size - 1) % path_size, i, (j + path_size - 1) % path_size, j};
+    Cost delta = 0;
+
+    for(size_t e = 0; e < 4; ++e) {
+        bool repeated = false;
+        for(size_t previous = 0; previous < e; ++previous) {
+            repeated = repeated || edges[previous] == edges[e];
+        }
+        if(repeated) {
+            continue;
+        }
+
+        size_t next = (edges[e] + 1) % path_size;
+        delta += (Cost)weights[node_after(edges[e])][node_after(next)] - (Cost)weights[path[edges[e]]][path[next]];
+    }
+
+    return delta;
+}
+
+template<typename Weight>
+typename WeightTraits<Weight>::Cost shift_delta(const std::vector<std::vector<Weight>>& weights,
+                                                const std::vector<int>& path, size_t i, size_t j) {
+    typedef typename WeightTraits<Weight>::Cost Cost;
+    size_t path_size = path.size();
+
+    // Mover para a posição vizinha equivale a uma troca
+    if(i + 1 == j || j + 1 == i) {
+        return swap_delta(weights, path, i, j);
+    }
+
+    // Mover o primeiro nó para o fim (ou o inverso) apenas rotaciona o ciclo
+    if(i == j || (i == 0 && j == path_size - 1) || (j == 0 && i == path_size - 1)) {
+        return 0;
+    }
+
+    // Os pesos são somados no tipo do custo, sem estouro para pesos inteiros
+    auto weight = [&](int from, int to) -> Cost { return weights[from][to]; };
+
+    int moved = path[i];
+    int before = path[(i + path_size - 1) % path_size];
+    int after = path[(i + 1) % path_size];
+
+    // O nó é retirado de entre seus vizinhos, que passam a ser ligados diretamente
+    Cost delta = weight(before, after) - weight(before, moved) - weight(moved, after);
+
+    // E é inserido entre os nós que ficam ao seu redor na posição j
+    int left, right;
+    if(i < j) {
+        left = path[j];
+        right = path[(j + 1) % path_size];
+    } else {
+        left = path[(j + path_size - 1) % path_size];
+        right = path[j];
+    }
+    delta += weight(left, moved) + weight(moved, right) - weight(left, right);
+
+    return delta;
+}
+
+template<typename Weight>
+typename WeightTraits<Weight>::Cost invert_delta(const std::vector<std::vector<Weight>>& weights,
+                                                 const std::vector<int>& path, size_t i, size_t j, bool symmetric) {
+    typedef typename WeightTraits<Weight>::Cost Cost;
+    size_t path_size = path.size();
+
+    // Inverter o caminho inteiro apenas muda o sentido do ciclo
+    if(i == 0 && j == path_size - 1) {
+        if(symmetric) {
+            return 0;
+        }
+        return calculate_path_cost(weights, std::vector<int>(path.rbegin(), path.rend())) -
+               calculate_path_cost(weights, path);
+    }
+
+    // Os pesos são somados no tipo do custo, sem estouro para pesos inteiros
+    auto weight = [&](int from, int to) -> Cost { return weights[from][to]; };
+
+    int before = path[(i + path_size - 1) % path_size];
+    int after = path[(j + 1) % path_size];
+
+    // Apenas as duas arestas das extremidades do trecho são trocadas
+    Cost delta = weight(before, path[j]) + weight(path[i], after)
+               - weight(before, path[i]) - weight(path[j], after);
+
+    // Em grafos assimétricos as arestas internas do trecho passam a ser percorridas no sentido oposto
+    if(!symmetric) {
+        for(size_t k = i; k < j; ++k) {
+            delta += weight(path[k + 1], path[k]) - weight(path[k], path[k + 1]);
+        }
+    }
+
+    return delta;
+}
+
 void apply_move(LocalSearchMethod method, std::vector<int>& path,
                 std::size_t i, std::size_t j) {
     switch (method) {
@@ -70,42 +186,166 @@ void apply_move(LocalSearchMethod method, std::vector<int>& path,
         case LocalSearchMethod::INVERT:
             apply_invert(path, i, j);
             break;
+        case LocalSearchMethod::VND:
+            // O VND combina os demais movimentos em local_search e não é um movimento por si só
+            break;
     }
 } 
 
 
+template<typename Weight>
+typename WeightTraits<Weight>::Cost move_delta(LocalSearchMethod method, const std::vector<std::vector<Weight>>& weights,
+                                               const std::vector<int>& path, size_t i, size_t j, bool symmetric) {
+    switch (method) {
+        case LocalSearchMethod::SWAP:
+            return swap_delta(weights, path, i, j);
+        case LocalSearchMethod::SHIFT:
+            return shift_delta(weights, path, i, j);
+        case LocalSearchMethod::INVERT:
+            // A inversão só é aplicada quando i < j
+            return i < j ? invert_delta(weights, path, i, j, symmetric) : 0;
+        case LocalSearchMethod::VND:
+            return 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief Variação de custo de um movimento com o método fixado em tempo de compilação
+ *
+ * Usada nos laços internos da busca local no lugar de move_delta, que decide o método a cada chamada.
+ */
+template<LocalSearchMethod Method, typename Weight>
+typename WeightTraits<Weight>::Cost move_delta_kernel(const std::vector<std::vector<Weight>>& weights,
+                                                      const std::vector<int>& path, size_t i, size_t j,
+                                                      bool symmetric) {
+    if constexpr (Method == LocalSearchMethod::SWAP) {
+        return swap_delta(weights, path, i, j);
+    } else if constexpr (Method == LocalSearchMethod::SHIFT) {
+        return shift_delta(weights, path, i, j);
+    } else {
+        // A inversão só é aplicada quando i < j
+        return i < j ? invert_delta(weights, path, i, j, symmetric) : 0;
+    }
+}
+
+/**
+ * @brief Aplica um movimento com o método fixado em tempo de compilação
+ */
+template<LocalSearchMethod Method>
+void apply_move_kernel(std::vector<int>& path, size_t i, size_t j) {
+    if constexpr (Method == LocalSearchMethod::SWAP) {
+        apply_swap(path, i, j);
+    } else if constexpr (Method == LocalSearchMethod::SHIFT) {
+        apply_shift(path, i, j);
+    } else {
+        apply_invert(path, i, j);
+    }
+}
+
+/**
+ * @brief Estado da varredura circular da primeira melhoria, mantido entre os passos da busca local
+ *
+ * Uma posição fica limpa quando nenhum movimento a partir dela melhora o caminho, e volta a ficar suja
+ * quando um movimento aplicado altera a vizinhança dela.
+ */
+struct FirstImprovementScan {
+    size_t start = 0; // Posição em que o próximo passo retoma a varredura
+    std::vector<bool> dirty; // Posições cujos movimentos ainda podem melhorar o caminho
+    size_t dirty_count = 0; // Número de posições sujas
+};
+
+/**
+ * @brief Marca como sujas as posições cujas arestas foram alteradas por um movimento
+ * @param scan O estado da varredura
+ * @param path_size O número de nós do caminho
+ * @param i O primeiro índice do movimento aplicado
+ * @param j O segundo índice do movimento aplicado
+ */
+void mark_dirty(FirstImprovementScan& scan, size_t path_size, size_t i, size_t j) {
+    if(scan.dirty.size() != path_size) {
+        return;
+    }
+
+    const size_t positions[] = {i + path_size - 1, i, i + 1, j + path_size - 1, j, j + 1};
+    for(size_t position : positions) {
+        position %= path_size;
+        if(!scan.dirty[position]) {
+            scan.dirty[position] = true;
+            scan.dirty_count++;
+        }
+    }
+}
+
 /**
  * @brief Aplica estratégia de primeira melhoria para obter uma solução melhor
+ *
+ * A varredura é circular e retoma a partir da posição da última melhoria, examinando apenas posições
+ * sujas. Quando todas estão limpas, uma passada completa confirma o ótimo local, já que as marcações
+ * cobrem apenas as vizinhanças mais afetadas pelos movimentos.
+ *
+ * @tparam Method O método de modificação
+ * @tparam Full Indica se a vizinhança completa (todos os pares ordenados) deve ser considerada
  * @param weights A matriz de pesos entre os nós do grafo.
  * @param current_path O caminho atual
  * @param current_cost O custo atual do caminho.
- * @param apply_method A função que aplica o método de modificação no caminho
- * @param is_full Indica se a vizinhança completa deve ser considerada
+ * @param symmetric Indica se a matriz de pesos é simétrica
+ * @param scan O estado da varredura, atualizado entre os passos
+ * @param move Recebe os índices do movimento aplicado
  * @return true se uma melhoria foi encontrada, false caso contrário
  */
-template<typename ApplyMethodFunc>
-bool first_improvement_step(const std::vector<std::vector<double>>& weights, std::vector<int>& current_path,
-    double& current_cost, ApplyMethodFunc apply_method, bool is_full = false) {
+template<LocalSearchMethod Method, bool Full, typename Weight>
+bool first_improvement_step(const std::vector<std::vector<Weight>>& weights, std::vector<int>& current_path,
+    typename WeightTraits<Weight>::Cost& current_cost, bool symmetric, FirstImprovementScan& scan,
+    std::pair<size_t, size_t>& move) {
 
     size_t path_size = current_path.size();
+    if(scan.dirty.size() != path_size) {
+        scan.start = 0;
+        scan.dirty.assign(path_size, true);
+        scan.dirty_count = path_size;
+    }
 
-    // Percorre a vizinhança em busca da primeira melhoria
-    for(size_t i = 0; i < path_size; i++) {
-        size_t j_start = is_full ? 1 : i + 1;
-        for(size_t j = j_start; j < path_size; j++) {
+    // Aplica o movimento se ele melhora o caminho
+    auto try_move = [&](size_t i, size_t j) {
+        auto delta = move_delta_kernel<Method>(weights, current_path, i, j, symmetric);
+        if(delta < -WeightTraits<Weight>::epsilon) {
+            apply_move_kernel<Method>(current_path, i, j);
+            current_cost += delta;
+            move = {i, j};
+            return true;
+        }
+        return false;
+    };
+
+    // Percorre as posições sujas a partir da última melhoria; em vizinhanças simétricas em i e j a
+    // posição é combinada com todas as outras, como primeiro ou segundo índice do movimento
+    for(size_t offset = 0; offset < path_size && scan.dirty_count > 0; offset++) {
+        size_t i = (scan.start + offset) % path_size;
+        if(!scan.dirty[i]) {
+            continue;
+        }
+
+        for(size_t j = Full ? 1 : 0; j < path_size; j++) {
             if(i == j) {
                 continue;
             }
-        
-            std::vector<int> temp_path = current_path;
-            //Aplica a modificação
-            apply_method(temp_path, i, j);
-            double new_cost = calculate_path_cost(weights, temp_path);
-
-            // Se é observada uma melhoria, atualiza o caminho e o custo e retorna true
-            if(new_cost < current_cost) {
-                current_path = temp_path;
-                current_cost = new_cost;
+            if(Full ? try_move(i, j) : try_move(std::min(i, j), std::max(i, j))) {
+                scan.start = i;
+                return true;
+            }
+        }
+
+        scan.dirty[i] = false;
+        scan.dirty_count--;
+    }
+
+    // Passada de confirmação sobre a vizinhança inteira
+    for(size_t i = 0; i < path_size; i++) {
+        size_t j_start = Full ? 1 : i + 1;
+        for(size_t j = j_start; j < path_size; j++) {
+            if(i != j && try_move(i, j)) {
+                scan.start = i;
                 return true;
             }
         }
@@ -114,79 +354,240 @@ bool first_improvement_step(const std::vector<std::vector<double>>& weights, std
 }
 
 
+/**
+ * @brief Melhor movimento encontrado em uma parte da vizinhança
+ * @tparam Weight O tipo dos pesos
+ */
+template<typename Weight>
+struct BestMove {
+    typename WeightTraits<Weight>::Cost delta = -WeightTraits<Weight>::epsilon; // Variação de custo (só melhorias são guardadas)
+    size_t i = 0;
+    size_t j = 0;
+    bool found = false;
+};
+
+/**
+ * @brief Retorna o conjunto de threads da busca local, criado no primeiro uso e reaproveitado entre passos
+ */
+WorkStealingPool& local_search_pool() {
+    static WorkStealingPool pool(LOCAL_SEARCH_THREADS);
+    return pool;
+}
+
 /**
  * @brief Aplica estratégia de melhor melhoria para obter melhor solução
+ *
+ * A partir de PARALLEL_BEST_IMPROVEMENT_NODES nós as linhas i da vizinhança são intercaladas entre
+ * as threads de local_search_pool(), cada uma com o seu melhor movimento. Na redução, empates na variação
+ * de custo ficam com o menor par (i, j), o mesmo movimento que a varredura sequencial escolhe, então o
+ * resultado não depende do número de threads. Chamadas feitas de dentro de um WorkStealingPool (um
+ * solver que já paraleliza por indivíduo ou por ramo) varrem sequencialmente para não disputar os núcleos.
+ *
+ * @tparam Method O método de modificação
+ * @tparam Full Indica se a vizinhança completa (todos os pares ordenados) deve ser considerada
  * @param weights A matriz de pesos entre os nós do grafo
  * @param current_path O caminho atual
  * @param current_cost O custo atual do caminho
- * @param apply_method A função que aplica o método de modificação no caminho
+ * @param symmetric Indica se a matriz de pesos é simétrica
  * @return true se uma melhoria foi encontrada, false caso contrário
  */
-template<typename ApplyMethodFunc>
-bool best_improvement_step(const std::vector<std::vector<double>>& weights, std::vector<int>& current_path,
-    double& current_cost, ApplyMethodFunc apply_method, bool is_full = false) {
+template<LocalSearchMethod Method, bool Full, typename Weight>
+bool best_improvement_step(const std::vector<std::vector<Weight>>& weights, std::vector<int>& current_path,
+    typename WeightTraits<Weight>::Cost& current_cost, bool symmetric) {
 
     size_t path_size = current_path.size();
-    bool improvement_found = false;
-    std::vector<int> best_path = current_path;
-    double best_cost = current_cost;
 
-    // Percorre toda a vizinhança para encontrar a melhor melhoria
-    for(size_t i = 0; i < path_size; i++) {
-        size_t j_start = is_full ? 1 : i + 1;
-        for(size_t j = j_start; j < path_size; j++) {
-            if(i == j) {
+    // Percorre as linhas first, first + step, ... da vizinhança guardando a melhor melhoria
+    auto scan_rows = [&](size_t first, size_t step, BestMove<Weight>& best) {
+        for(size_t i = first; i < path_size; i += step) {
+            size_t j_start = Full ? 1 : i + 1;
+            for(size_t j = j_start; j < path_size; j++) {
+                if(i == j) {
+                    continue;
+                }
+
+                auto delta = move_delta_kernel<Method>(weights, current_path, i, j, symmetric);
+
+                // Se é observada uma melhoria, guarda o melhor movimento encontrado
+                if(delta < best.delta) {
+                    best.delta = delta;
+                    best.i = i;
+                    best.j = j;
+                    best.found = true;
+                }
+            }
+        }
+    };
+
+    size_t threads = 1;
+    if(path_size >= PARALLEL_BEST_IMPROVEMENT_NODES && !WorkStealingPool::on_worker()) {
+        threads = local_search_pool().size();
+    }
+
+    BestMove<Weight> best;
+    if(threads == 1) {
+        scan_rows(0, 1, best);
+    } else {
+        std::vector<BestMove<Weight>> partial(threads);
+        local_search_pool().run_batch(threads, [&](size_t t) {
+            scan_rows(t, threads, partial[t]);
+        });
+
+        for(const BestMove<Weight>& candidate : partial) {
+            if(!candidate.found) {
                 continue;
             }
-            std::vector<int> temp_path = current_path;
-            //Aplica a modificação
-            apply_method(temp_path, i, j);
-            double new_cost = calculate_path_cost(weights, temp_path);
-
-            // Se é observada uma melhoria, atualiza a melhor solução encontrada
-            if(new_cost < best_cost) {
-                best_path = temp_path;
-                best_cost = new_cost;
-                improvement_found = true;
+            if(!best.found || candidate.delta < best.delta || (candidate.delta == best.delta &&
+               std::make_pair(candidate.i, candidate.j) < std::make_pair(best.i, best.j))) {
+                best = candidate;
             }
         }
     }
 
-    // Se uma melhoria foi encontrada, atualiza o caminho e o custo atuais
-    if(improvement_found) {
-        current_path = best_path;
-        current_cost = best_cost;
+    // Se uma melhoria foi encontrada, aplica o melhor movimento e atualiza o custo
+    if(best.found) {
+        apply_move_kernel<Method>(current_path, best.i, best.j);
+        current_cost += best.delta;
     }
 
-    return improvement_found;
+    return best.found;
 }
 
-LocalSearchResult local_search(const std::vector<std::vector<double>>& weights,
-    const std::vector<int>& initial_path, LocalSearchMethod method, ImprovementType improvement) {
+/**
+ * @brief Executa um passo da estratégia de melhoria em uma vizinhança, ambas fixadas em tempo de compilação
+ * @return true se uma melhoria foi aplicada, false caso contrário
+ */
+template<LocalSearchMethod Method, ImprovementType Improvement, typename Weight>
+bool improvement_step(const std::vector<std::vector<Weight>>& weights, std::vector<int>& current_path,
+    typename WeightTraits<Weight>::Cost& current_cost, bool symmetric, FirstImprovementScan& scan,
+    std::pair<size_t, size_t>& move) {
+
+    // O deslocamento não é simétrico em i e j, então considera todos os pares
+    constexpr bool full = Method == LocalSearchMethod::SHIFT;
+
+    if constexpr (Improvement == ImprovementType::FIRST_IMPROVEMENT) {
+        return first_improvement_step<Method, full>(weights, current_path, current_cost, symmetric, scan, move);
+    } else {
+        return best_improvement_step<Method, full>(weights, current_path, current_cost, symmetric);
+    }
+}
+
+/**
+ * @brief Busca local especializada para uma estratégia de melhoria e uma sequência de vizinhanças
+ *
+ * Com uma única vizinhança é a descida comum; com várias é o VND, que volta à primeira vizinhança a cada
+ * melhoria e avança para a próxima quando a atual não melhora mais, até um ótimo comum a todas. A escolha
+ * da vizinhança acontece uma vez por passo, e os laços internos de cada passo são especializados.
+ *
+ * @tparam Improvement A estratégia de melhoria
+ * @tparam Neighborhoods Os métodos de modificação, na ordem em que são percorridos
+ * @tparam Weight O tipo dos pesos
+ */
+template<ImprovementType Improvement, LocalSearchMethod... Neighborhoods, typename Weight>
+BasicLocalSearchResult<typename WeightTraits<Weight>::Cost> descend(const std::vector<std::vector<Weight>>& weights,
+    const std::vector<int>& initial_path, const LocalSearchBudget& budget) {
+
+    typedef typename WeightTraits<Weight>::Cost Cost;
+    typedef bool (*Step)(const std::vector<std::vector<Weight>>&, std::vector<int>&, Cost&, bool,
+                         FirstImprovementScan&, std::pair<size_t, size_t>&);
+    const Step steps[] = {&improvement_step<Neighborhoods, Improvement, Weight>...};
+    constexpr size_t neighborhood_count = sizeof...(Neighborhoods);
 
     std::vector<int> current_path = initial_path;
-    double current_cost = calculate_path_cost(weights, current_path);
+    Cost current_cost = calculate_path_cost(weights, current_path);
     bool improvement_found = true;
-    bool is_full = (method == LocalSearchMethod::SHIFT);
+    bool symmetric = is_symmetric(weights);
+    size_t neighborhood = 0;
 
-    // Define a função de aplicação do método baseado no tipo selecionado
-    auto apply_method = [&](std::vector<int>& path, size_t i, size_t j) {
-        apply_move(method, path, i, j);
-    };
+    // Cada vizinhança tem sua própria varredura, e todo movimento aplicado suja as posições em todas elas
+    FirstImprovementScan scans[neighborhood_count];
+    std::pair<size_t, size_t> move;
+
+    auto start_time = std::chrono::steady_clock::now();
+    size_t moves = 0;
 
-    // Executa a busca local até que nenhuma melhoria seja encontrada
+    // Executa a busca local até que nenhuma melhoria seja encontrada ou o orçamento se esgote
     while(improvement_found) {
-        if(improvement == ImprovementType::FIRST_IMPROVEMENT) {
-            improvement_found = first_improvement_step(weights, current_path, current_cost, apply_method, is_full);
-        } else { 
-            improvement_found = best_improvement_step(weights, current_path, current_cost, apply_method, is_full);
+        if(budget.max_moves > 0 && moves >= budget.max_moves) {
+            break;
+        }
+        if(budget.max_ms > 0 && std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start_time).count() >= budget.max_ms) {
+            break;
+        }
+        if(budget.cancel != nullptr && budget.cancel->load(std::memory_order_relaxed)) {
+            break;
+        }
+
+        if(steps[neighborhood](weights, current_path, current_cost, symmetric, scans[neighborhood], move)) {
+            if constexpr (Improvement == ImprovementType::FIRST_IMPROVEMENT) {
+                for(size_t k = 0; k < neighborhood_count; k++) {
+                    mark_dirty(scans[k], current_path.size(), move.first, move.second);
+                }
+            }
+            neighborhood = 0;
+            moves++;
+        } else if(++neighborhood >= neighborhood_count) {
+            improvement_found = false;
         }
     }
 
-    LocalSearchResult result;
+    BasicLocalSearchResult<Cost> result;
     result.solution = std::move(current_path);
-    result.cost = current_cost;
+    // O custo é recalculado para não acumular os erros de arredondamento das variações (exatas com pesos inteiros)
+    result.cost = calculate_path_cost(weights, result.solution);
+    result.converged = !improvement_found;
 
     return result;
 }
 
+/**
+ * @brief Seleciona, uma única vez, a busca local especializada para o método informado
+ */
+template<ImprovementType Improvement, typename Weight>
+BasicLocalSearchResult<typename WeightTraits<Weight>::Cost> local_search_with(
+    const std::vector<std::vector<Weight>>& weights, const std::vector<int>& initial_path,
+    LocalSearchMethod method, const LocalSearchBudget& budget) {
+
+    switch (method) {
+        case LocalSearchMethod::SWAP:
+            return descend<Improvement, LocalSearchMethod::SWAP>(weights, initial_path, budget);
+        case LocalSearchMethod::SHIFT:
+            return descend<Improvement, LocalSearchMethod::SHIFT>(weights, initial_path, budget);
+        case LocalSearchMethod::INVERT:
+            return descend<Improvement, LocalSearchMethod::INVERT>(weights, initial_path, budget);
+        case LocalSearchMethod::VND:
+            // A inversão vem primeiro por levar a ótimos melhores nas instâncias de teste
+            return descend<Improvement, LocalSearchMethod::INVERT, LocalSearchMethod::SHIFT,
+                           LocalSearchMethod::SWAP>(weights, initial_path, budget);
+    }
+    return descend<Improvement, LocalSearchMethod::SWAP>(weights, initial_path, budget);
+}
+
+template<typename Weight>
+BasicLocalSearchResult<typename WeightTraits<Weight>::Cost> local_search(
+    const std::vector<std::vector<Weight>>& weights, const std::vector<int>& initial_path,
+    LocalSearchMethod method, ImprovementType improvement, const LocalSearchBudget& budget) {
+
+    if(improvement == ImprovementType::FIRST_IMPROVEMENT) {
+        return local_search_with<ImprovementType::FIRST_IMPROVEMENT>(weights, initial_path, method, budget);
+    }
+    return local_search_with<ImprovementType::BEST_IMPROVEMENT>(weights, initial_path, method, budget);
+}
+
+// Instanciações para pesos double e para pesos inteiros em ponto fixo
+#define INSTANTIATE_LOCAL_SEARCH(Weight) \
+    template BasicLocalSearchResult<WeightTraits<Weight>::Cost> local_search<Weight>( \
+        const std::vector<std::vector<Weight>>&, const std::vector<int>&, LocalSearchMethod, ImprovementType, \
+        const LocalSearchBudget&); \
+    template WeightTraits<Weight>::Cost swap_delta<Weight>(const std::vector<std::vector<Weight>>&, \
+        const std::vector<int>&, size_t, size_t); \
+    template WeightTraits<Weight>::Cost shift_delta<Weight>(const std::vector<std::vector<Weight>>&, \
+        const std::vector<int>&, size_t, size_t); \
+    template WeightTraits<Weight>::Cost invert_delta<Weight>(const std::vector<std::vector<Weight>>&, \
+        const std::vector<int>&, size_t, size_t, bool); \
+    template WeightTraits<Weight>::Cost move_delta<Weight>(LocalSearchMethod, \
+        const std::vector<std::vector<Weight>>&, const std::vector<int>&, size_t, size_t, bool);
+
+INSTANTIATE_LOCAL_SEARCH(double)
+INSTANTIATE_LOCAL_SEARCH(int32_t)
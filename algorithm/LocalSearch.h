@@ -3,15 +3,59 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
+#include <atomic>
+
+// Tolerância usada para que variações de custo desprezíveis não sejam consideradas melhorias
+#define IMPROVEMENT_EPSILON 1e-9
+// Número de nós a partir do qual cada passo da melhor melhoria divide a vizinhança entre threads
+#define PARALLEL_BEST_IMPROVEMENT_NODES 500
+// Threads da melhor melhoria paralela (0 utiliza uma por núcleo disponível)
+#define LOCAL_SEARCH_THREADS 0
+
+/**
+ * @brief Tipos de custo associados ao tipo dos pesos da matriz
+ *
+ * Pesos double acumulam em double e usam IMPROVEMENT_EPSILON nas comparações. Pesos inteiros em ponto fixo
+ * (int32_t, ver populate_graph_from_csv com escala) acumulam em int64_t, e as variações são exatas.
+ *
+ * @tparam Weight O tipo dos pesos
+ */
+template<typename Weight>
+struct WeightTraits {
+    typedef double Cost;
+    static constexpr double epsilon = IMPROVEMENT_EPSILON;
+};
+
+template<>
+struct WeightTraits<int32_t> {
+    typedef int64_t Cost;
+    static constexpr int64_t epsilon = 0;
+};
 
 /**
  * @brief Estrutura para armazenar o resultado da busca local
+ * @tparam Cost O tipo do custo (double, ou int64_t para pesos inteiros)
  */
-struct LocalSearchResult {
+template<typename Cost>
+struct BasicLocalSearchResult {
     std::vector<int> solution; // Solução encontrada
-    double cost; // Custo total da solução
+    Cost cost; // Custo total da solução
+    bool converged; // Indica se a solução é um ótimo local (false quando o orçamento se esgotou antes)
 
-    LocalSearchResult() : cost(0.0) {}
+    BasicLocalSearchResult() : cost(0), converged(true) {}
+};
+
+typedef BasicLocalSearchResult<double> LocalSearchResult;
+typedef BasicLocalSearchResult<int64_t> IntegerLocalSearchResult;
+
+/**
+ * @brief Orçamento de uma busca local; valores 0 indicam ausência de limite
+ */
+struct LocalSearchBudget {
+    size_t max_moves = 0; // Número máximo de movimentos de melhora aplicados
+    double max_ms = 0.0; // Tempo máximo da busca, em milissegundos
+    const std::atomic<bool>* cancel = nullptr; // Sinal de cancelamento cooperativo, verificado a cada passo
 };
 
 
@@ -21,7 +65,8 @@ struct LocalSearchResult {
 enum class LocalSearchMethod {
     SWAP,
     SHIFT,
-    INVERT
+    INVERT,
+    VND // Descida em vizinhança variável: alterna entre INVERT, SHIFT e SWAP até um ótimo comum
 };
 
 /**
@@ -32,14 +77,90 @@ enum class ImprovementType {
     BEST_IMPROVEMENT
 };
 
-LocalSearchResult local_search(const std::vector<std::vector<double>>& weights,
+/**
+ * @brief Aplica a busca local até um ótimo local ou até o orçamento se esgotar
+ *
+ * Instanciada para pesos double e int32_t (ponto fixo).
+ *
+ * @tparam Weight O tipo dos pesos
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param initial_path O caminho inicial
+ * @param method O método de modificação
+ * @param improvement A estratégia de melhoria
+ * @param budget O orçamento de movimentos e de tempo (sem limite por padrão)
+ * @return A melhor solução encontrada e seu custo
+ */
+template<typename Weight>
+BasicLocalSearchResult<typename WeightTraits<Weight>::Cost> local_search(
+                               const std::vector<std::vector<Weight>>& weights,
                                const std::vector<int>& initial_path,
                                LocalSearchMethod method,
-                               ImprovementType improvement);
+                               ImprovementType improvement,
+                               const LocalSearchBudget& budget = LocalSearchBudget());
 
 void apply_shift(std::vector<int>& path, size_t i, size_t j);
 void apply_swap(std::vector<int>& path, size_t i, size_t j);
 void apply_invert(std::vector<int>& path, size_t i, size_t j);
 
+/**
+ * @brief Aplica o método de modificação selecionado no caminho
+ * @param method O método de modificação
+ * @param path O caminho onde a operação será aplicada
+ * @param i O primeiro índice do movimento
+ * @param j O segundo índice do movimento
+ */
+void apply_move(LocalSearchMethod method, std::vector<int>& path, size_t i, size_t j);
+
+/**
+ * @brief Calcula a variação de custo da troca dos nós nas posições i e j sem reconstruir o caminho
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho atual
+ * @param i O primeiro índice
+ * @param j O segundo índice
+ * @return O custo do caminho após a troca menos o custo atual
+ */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost swap_delta(const std::vector<std::vector<Weight>>& weights,
+                                               const std::vector<int>& path, size_t i, size_t j);
+
+/**
+ * @brief Calcula a variação de custo de mover o nó da posição i para a posição j sem reconstruir o caminho
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho atual
+ * @param i O índice do nó a ser movido
+ * @param j O índice para onde o nó será movido
+ * @return O custo do caminho após o deslocamento menos o custo atual
+ */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost shift_delta(const std::vector<std::vector<Weight>>& weights,
+                                                const std::vector<int>& path, size_t i, size_t j);
+
+/**
+ * @brief Calcula a variação de custo da inversão do trecho [i, j] sem reconstruir o caminho
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho atual
+ * @param i O índice inicial do trecho (i < j)
+ * @param j O índice final do trecho
+ * @param symmetric Indica se a matriz de pesos é simétrica (O(1)); caso contrário o trecho é percorrido
+ * @return O custo do caminho após a inversão menos o custo atual
+ */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost invert_delta(const std::vector<std::vector<Weight>>& weights,
+                                                 const std::vector<int>& path, size_t i, size_t j, bool symmetric);
+
+/**
+ * @brief Calcula a variação de custo do movimento selecionado sem reconstruir o caminho
+ * @param method O método de modificação
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param path O caminho atual
+ * @param i O primeiro índice do movimento
+ * @param j O segundo índice do movimento
+ * @param symmetric Indica se a matriz de pesos é simétrica
+ * @return O custo do caminho após o movimento menos o custo atual
+ */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost move_delta(LocalSearchMethod method, const std::vector<std::vector<Weight>>& weights,
+                                               const std::vector<int>& path, size_t i, size_t j, bool symmetric);
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,339 @@
+#ifndef LOWER_BOUND_H
+#define LOWER_BOUND_H
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <mutex>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#include "SmallTSP.h"
+#include "LocalSearch.h"
+#include "../utils/TSPUtils.h"
+
+// Número de iterações da otimização por subgradiente do limitante de Held-Karp
+#define SUBGRADIENT_ITERATIONS 1000
+// Passo inicial da otimização por subgradiente (reduzido à metade quando o limitante estagna)
+#define SUBGRADIENT_INITIAL_STEP 2.0
+// Maior instância cujo limitante é o próprio custo ótimo, calculado pelo Held-Karp
+#define LOWER_BOUND_EXACT_NODES 12
+// Gap relativo padrão em que os solvers encerram a busca (negativo desativa o critério; 0 encerra apenas com a
+// otimalidade provada)
+#define DEFAULT_GAP_TARGET -1.0
+
+/**
+ * @brief Estrutura para armazenar uma 1-árvore mínima
+ */
+struct OneTree {
+    double cost; // Custo da 1-árvore com os pesos penalizados
+    std::vector<int> degree; // Grau de cada nó na 1-árvore
+
+    OneTree() : cost(0.0) {}
+};
+
+/**
+ * @brief Calcula a 1-árvore mínima com os pesos penalizados w(a, b) + pi(a) + pi(b)
+ *
+ * A 1-árvore é uma árvore geradora mínima dos nós 1..n-1 mais as duas arestas mais baratas do nó 0.
+ * Todo ciclo hamiltoniano é uma 1-árvore, então seu custo menos 2 * soma(pi) é um limitante inferior
+ * para o custo do ciclo. Cada aresta usa o menor dos dois sentidos, o que mantém o limitante válido
+ * também para matrizes assimétricas.
+ *
+ * @param weights A matriz de pesos com pelo menos três nós
+ * @param penalties As penalidades pi de cada nó
+ * @return O custo penalizado e os graus da 1-árvore
+ */
+OneTree minimum_one_tree(const std::vector<std::vector<double>>& weights, const std::vector<double>& penalties) {
+    int order = weights.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    auto edge = [&](int a, int b) {
+        return std::min(weights[a][b], weights[b][a]) + penalties[a] + penalties[b];
+    };
+
+    OneTree tree;
+    tree.degree.assign(order, 0);
+
+    // Prim sobre os nós 1..n-1
+    std::vector<double> distance(order, infinity);
+    std::vector<int> parent(order, -1);
+    std::vector<char> in_tree(order, 0);
+    distance[1] = 0.0;
+
+    for (int step = 1; step < order; step++) {
+        int next = -1;
+        for (int node = 1; node < order; node++) {
+            if (!in_tree[node] && (next == -1 || distance[node] < distance[next])) {
+                next = node;
+            }
+        }
+
+        in_tree[next] = 1;
+        if (parent[next] != -1) {
+            tree.cost += distance[next];
+            tree.degree[next]++;
+            tree.degree[parent[next]]++;
+        }
+
+        for (int node = 1; node < order; node++) {
+            if (!in_tree[node]) {
+                double candidate = edge(next, node);
+                if (candidate < distance[node]) {
+                    distance[node] = candidate;
+                    parent[node] = next;
+                }
+            }
+        }
+    }
+
+    // As duas arestas mais baratas do nó 0
+    int first = -1, second = -1;
+    for (int node = 1; node < order; node++) {
+        if (first == -1 || edge(0, node) < edge(0, first)) {
+            second = first;
+            first = node;
+        } else if (second == -1 || edge(0, node) < edge(0, second)) {
+            second = node;
+        }
+    }
+
+    tree.cost += edge(0, first) + edge(0, second);
+    tree.degree[0] = 2;
+    tree.degree[first]++;
+    tree.degree[second]++;
+
+    return tree;
+}
+
+/**
+ * @brief Calcula o limitante inferior de Held-Karp por otimização por subgradiente
+ *
+ * As penalidades de nós com grau maior que 2 na 1-árvore são aumentadas e as de nós folha são
+ * reduzidas, com passo proporcional à distância entre o limitante atual e o limitante superior. O passo
+ * é reduzido à metade após um período sem melhora. Se a 1-árvore se tornar um ciclo, o limitante é o
+ * próprio custo ótimo.
+ *
+ * @param weights A matriz de pesos com pelo menos três nós
+ * @param upper_bound O custo de um caminho conhecido
+ * @param iterations O número máximo de iterações
+ * @param penalties As penalidades iniciais, substituídas pelas que produziram o melhor limitante
+ * @param deadline O instante em que a otimização é interrompida
+ * @return O melhor limitante inferior encontrado
+ */
+double held_karp_bound(const std::vector<std::vector<double>>& weights, double upper_bound, int iterations,
+    std::vector<double>& penalties,
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max()) {
+
+    int order = weights.size();
+    penalties.resize(order, 0.0);
+
+    std::vector<double> current = penalties;
+    double best_bound = -std::numeric_limits<double>::infinity();
+    double step = SUBGRADIENT_INITIAL_STEP;
+    int period = std::max(order / 2, 10);
+    int stagnant = 0;
+
+    for (int iteration = 0; iteration < iterations; iteration++) {
+        if (iteration > 0 && std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+
+        OneTree tree = minimum_one_tree(weights, current);
+
+        double penalty_sum = 0.0;
+        for (double pi : current) {
+            penalty_sum += pi;
+        }
+        double bound = tree.cost - 2.0 * penalty_sum;
+
+        if (bound > best_bound) {
+            best_bound = bound;
+            penalties = current;
+            stagnant = 0;
+        } else if (++stagnant >= period) {
+            step /= 2.0;
+            stagnant = 0;
+        }
+
+        double norm = 0.0;
+        for (int node = 0; node < order; node++) {
+            norm += (tree.degree[node] - 2) * (tree.degree[node] - 2);
+        }
+
+        // A 1-árvore é um ciclo hamiltoniano ou o limitante já alcançou o superior
+        if (norm == 0.0 || bound >= upper_bound || step < 1e-6) {
+            break;
+        }
+
+        double gap = std::isfinite(upper_bound) ? upper_bound - bound : std::abs(bound) * 0.05 + 1.0;
+        double size = step * gap / norm;
+        for (int node = 0; node < order; node++) {
+            current[node] += size * (tree.degree[node] - 2);
+        }
+    }
+
+    return best_bound;
+}
+
+/**
+ * @brief Calcula o limitante inferior da árvore geradora mínima
+ *
+ * Removendo uma aresta de qualquer ciclo hamiltoniano resta uma árvore geradora, então o custo da árvore
+ * geradora mínima (com o menor dos dois sentidos de cada aresta) nunca supera o custo ótimo.
+ *
+ * @param weights A matriz de pesos
+ * @return O custo da árvore geradora mínima
+ */
+double mst_bound(const std::vector<std::vector<double>>& weights) {
+    int order = weights.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    if (order < 2) {
+        return 0.0;
+    }
+
+    std::vector<double> distance(order, infinity);
+    std::vector<char> in_tree(order, 0);
+    double cost = 0.0;
+    distance[0] = 0.0;
+
+    for (int step = 0; step < order; step++) {
+        int next = -1;
+        for (int node = 0; node < order; node++) {
+            if (!in_tree[node] && (next == -1 || distance[node] < distance[next])) {
+                next = node;
+            }
+        }
+
+        in_tree[next] = 1;
+        cost += distance[next];
+
+        for (int node = 0; node < order; node++) {
+            if (!in_tree[node]) {
+                distance[node] = std::min(distance[node], std::min(weights[next][node], weights[node][next]));
+            }
+        }
+    }
+
+    return cost;
+}
+
+/**
+ * @brief Calcula o limitante inferior da 1-árvore mínima sem penalidades
+ * @param weights A matriz de pesos com pelo menos três nós
+ * @return O custo da 1-árvore mínima
+ */
+double one_tree_bound(const std::vector<std::vector<double>>& weights) {
+    return minimum_one_tree(weights, std::vector<double>(weights.size(), 0.0)).cost;
+}
+
+/**
+ * @brief Calcula um limitante inferior da instância, guardado em cache para as chamadas seguintes
+ *
+ * Instâncias pequenas usam o custo ótimo do Held-Karp. As demais usam o limitante de Held-Karp por
+ * subgradiente, com o limitante superior dado pelo vizinho mais próximo seguido de 2-opt. O cache é
+ * indexado por um hash do conteúdo da matriz e do número de iterações, e pode ser consultado por
+ * várias threads. Com limite de tempo o 2-opt é omitido, e um limitante interrompido pelo tempo não é
+ * guardado no cache.
+ *
+ * @param weights A matriz de pesos
+ * @param iterations O número de iterações do subgradiente
+ * @param time_limit_ms O tempo limite do cálculo em milissegundos (0 desativa o limite)
+ * @return O limitante inferior do custo ótimo
+ */
+double instance_lower_bound(const std::vector<std::vector<double>>& weights,
+    int iterations = SUBGRADIENT_ITERATIONS, double time_limit_ms = 0) {
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    static std::mutex cache_mutex;
+    static std::unordered_map<uint64_t, double> cache;
+
+    size_t order = weights.size();
+    if (order < 3) {
+        return order == 2 ? weights[0][1] + weights[1][0] : 0.0;
+    }
+
+    // Hash FNV-1a da ordem, das iterações e dos pesos
+    uint64_t key = 14695981039346656037ull;
+    auto mix = [&key](uint64_t value) {
+        for (int byte = 0; byte < 8; byte++) {
+            key = (key ^ ((value >> (8 * byte)) & 0xff)) * 1099511628211ull;
+        }
+    };
+    mix(order);
+    mix(iterations);
+    for (const auto& row : weights) {
+        for (double weight : row) {
+            uint64_t bits;
+            std::memcpy(&bits, &weight, sizeof(bits));
+            mix(bits);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto cached = cache.find(key);
+        if (cached != cache.end()) {
+            return cached->second;
+        }
+    }
+
+    double bound;
+    bool complete = true;
+    if (order <= LOWER_BOUND_EXACT_NODES) {
+        bound = small_tsp(weights).cost;
+    } else {
+        // Limitante superior para o passo do subgradiente: vizinho mais próximo a partir do nó 0 e 2-opt
+        std::vector<int> path = {0};
+        std::vector<char> visited(order, 0);
+        visited[0] = 1;
+        while (path.size() < order) {
+            int next = -1;
+            for (size_t node = 0; node < order; node++) {
+                if (!visited[node] && (next == -1 || weights[path.back()][node] < weights[path.back()][next])) {
+                    next = node;
+                }
+            }
+            visited[next] = 1;
+            path.push_back(next);
+        }
+        double upper_bound = time_limit_ms > 0 ? calculate_path_cost(weights, path) :
+            local_search(weights, path, LocalSearchMethod::INVERT, ImprovementType::FIRST_IMPROVEMENT).cost;
+
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        if (time_limit_ms > 0) {
+            deadline = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(time_limit_ms));
+        }
+
+        std::vector<double> penalties(order, 0.0);
+        bound = std::max(held_karp_bound(weights, upper_bound, iterations, penalties, deadline), mst_bound(weights));
+        bound = std::min(bound, upper_bound);
+        complete = std::chrono::steady_clock::now() < deadline;
+    }
+
+    if (complete) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache[key] = bound;
+    }
+    return bound;
+}
+
+/**
+ * @brief Indica se um custo está dentro do gap desejado em relação ao limitante inferior
+ * @param cost O custo da solução
+ * @param lower_bound O limitante inferior (não positivo quando desconhecido)
+ * @param gap_target O gap relativo desejado (negativo desativa o critério)
+ * @return true se cost <= lower_bound * (1 + gap_target)
+ */
+bool gap_target_reached(double cost, double lower_bound, double gap_target) {
+    return gap_target >= 0 && lower_bound > 0 && cost <= lower_bound * (1.0 + gap_target) + IMPROVEMENT_EPSILON;
+}
+
+#endif // LOWER_BOUND_H
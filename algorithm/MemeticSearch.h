@@ -2,9 +2,28 @@
 #define MEMETIC_SEARCH_H
 
 #include <vector>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
 #include "../graph/IGraph.h"
 #include "GeneticSearch.h"
 #include "LocalSearch.h"
+#include "SolverControl.h"
+#include "../utils/TourHash.h"
+#include "../utils/ThreadPool.h"
+
+// Número máximo de resultados guardados no cache da busca local (ao encher, o cache é esvaziado)
+#define LOCAL_SEARCH_CACHE_CAPACITY 100000
+
+/**
+ * @brief Cache de resultados da busca local indexado pelo hash do ciclo de entrada
+ *
+ * Só é válido para uma única política de busca local (método, tipo de melhoria e orçamento) sobre a mesma
+ * instância.
+ */
+typedef std::unordered_map<uint64_t, LocalSearchResult> LocalSearchCache;
 
 template <typename Node>
 void print_population(const IGraph<Node> &graph, const std::vector<std::vector<double>> &weights,
@@ -29,132 +48,326 @@ void print_population(const IGraph<Node> &graph, const std::vector<std::vector<d
 // Geração da População Inicial
 template <typename Node>
 std::vector<Individual> generate_initial_population(const IGraph<Node> &graph,
-                                                    const std::vector<std::vector<double>> &weights)
+                                                    const std::vector<std::vector<double>> &weights,
+                                                    size_t population_size = POPULATION_SIZE)
 {
-    return generate_population(graph, weights);
+    return generate_population(graph, weights, population_size);
 };
 
 // (2) Fitness
-void calculate_initial_fitness(std::vector<Individual> &population,
-                               const std::vector<std::vector<double>> &weights)
+// Os custos são calculados em lote sobre a matriz plana, construída uma vez por execução
+void calculate_initial_fitness(std::vector<Individual> &population, const FlatWeights &weights)
 {
     calculate_fitness(population, weights);
 };
 
 // (3) Nova Geração
-std::vector<Individual> generate_new_individuas(std::vector<Individual> &population, const std::vector<std::vector<double>> &weights, int iteration_count, std::pair<int, int> &last_parents)
+// Os params.offspring_batch filhos (dois por par de pais) são montados em offsprings, reaproveitando os
+// buffers dos filhos da iteração anterior
+// Sem seletor, os pais são escolhidos pela seleção híbrida com os ciclos de params
+// Com a matriz plana, os custos dos filhos são calculados em lote
+void generate_new_individuas(std::vector<Individual> &population, const std::vector<std::vector<double>> &weights, int iteration_count, std::pair<int, int> &last_parents,
+                             std::vector<Individual> &offsprings, OffspringWorkspace &workspace,
+                             const CrossoverOperator &crossover_operator = CrossoverOperator(),
+                             const GeneticParameters &params = GeneticParameters(),
+                             const ParentSelector *selector = nullptr,
+                             const FlatWeights *flat = nullptr)
 {
-    std::pair<int, int> parents = select_parents(population, iteration_count, last_parents);
+    size_t batch = std::max<size_t>(1, params.offspring_batch);
+    int pairs = (batch + 1) / 2;
+    offsprings.resize(batch);
 
-    // Cruzamento por crossover
-    std::vector<int> path1 = ordered_crossover(population[parents.first], population[parents.second]);
-    Individual child1 = {path1, -1, -1};
+    for (int pair = 0; pair < pairs; pair++)
+    {
+        // Cada par avança o ciclo da seleção híbrida como uma iteração
+        int selection_count = iteration_count * pairs + pair;
+        std::pair<int, int> parents = selector != nullptr ?
+            selector->select(population, selection_count, last_parents) :
+            select_parents(population, selection_count, last_parents, params.selection_cycle, params.random_selections);
+
+        for (size_t child = 0; child < 2 && 2 * pair + child < batch; child++)
+        {
+            const Individual &first = population[child == 0 ? parents.first : parents.second];
+            const Individual &second = population[child == 0 ? parents.second : parents.first];
+            Individual &offspring = offsprings[2 * pair + child];
 
-    std::vector<int> path2 = ordered_crossover(population[parents.second], population[parents.first]);
-    Individual child2 = {path2, -1, -1};
+            // Cruzamento por crossover
+            crossover(crossover_operator, first.path, second.path, weights, offspring.path, workspace);
+            offspring.hash = tour_hash(offspring.path);
 
-    // Mutação com taxa de 50%
-    apply_mutation(child1, MUTATION_PERCENT);
-    apply_mutation(child2, MUTATION_PERCENT);
+            // Mutação com a taxa configurada
+            apply_mutation(offspring, params.mutation_percent);
 
-    child1.cost = calculate_path_cost(weights, child1.path);
-    child2.cost = calculate_path_cost(weights, child2.path);
-    child1.fitness = 1 / child1.cost;
-    child2.fitness = 1 / child2.cost;
+            if (flat == nullptr)
+            {
+                offspring.cost = calculate_path_cost(weights, offspring.path);
+                offspring.fitness = 1 / offspring.cost;
+            }
+        }
+    }
 
-    std::vector<Individual> offsprings = {child1, child2};
+    if (flat != nullptr)
+    {
+        workspace.batch_paths.clear();
+        for (const Individual &offspring : offsprings)
+        {
+            workspace.batch_paths.push_back(offspring.path.data());
+        }
+        calculate_path_costs(*flat, workspace.batch_paths, population[0].path.size(), workspace.batch_costs);
 
-    return offsprings;
+        for (size_t k = 0; k < offsprings.size(); k++)
+        {
+            offsprings[k].cost = workspace.batch_costs[k];
+            offsprings[k].fitness = 1 / offsprings[k].cost;
+        }
+    }
 };
 
 // (4) Busca local
+// Indica se um filho com o custo informado passa pelo filtro de custo da política
+bool accepts_local_search(const LocalSearchPolicy &policy, double cost, double best_cost)
+{
+    return policy.threshold_percent <= 0 || cost <= best_cost * (1 + policy.threshold_percent / 100);
+};
+
+// Aproveita o resultado da busca local no filho: no modo lamarckiano o filho passa a ser o ótimo local, e no
+// baldwiniano mantém o seu caminho (e a diversidade da população) com o custo do ótimo local
+void write_back(Individual &individual, const LocalSearchResult &optimum, WriteBackType type)
+{
+    if (type == WriteBackType::LAMARCKIAN)
+    {
+        individual.path = optimum.solution;
+        individual.hash = tour_hash(individual.path);
+    }
+    individual.cost = optimum.cost;
+    individual.fitness = 1 / individual.cost;
+};
+
 // Função para melhorar cada indivíduo da população usando busca local
 // Note: não é template porque o tipo de nó não é necessário aqui
+// Com best_solution, apenas os filhos dentro do limiar da política em relação a ela passam pela busca local,
+// e ela é substituída pela melhor solução real do lote (o ótimo local, mesmo no modo baldwiniano) se for melhor
+// Com cache, ciclos já vistos (como entrada ou como ótimo local) reutilizam o resultado anterior
+// Com pool, as buscas locais do lote são tarefas do conjunto de threads; a consulta e a atualização do
+// cache ficam na thread que chama, na ordem do lote, então o resultado não depende do escalonamento
 void improve_individuas(
     const std::vector<std::vector<double>> &weights,
     std::vector<Individual> &population,
-    LocalSearchMethod method,
-    ImprovementType improvement)
+    const LocalSearchPolicy &policy,
+    Individual *best_solution = nullptr,
+    LocalSearchCache *cache = nullptr,
+    WorkStealingPool *pool = nullptr)
 {
+    size_t batch = population.size();
+    std::vector<uint64_t> input_hashes(batch);
+    std::vector<size_t> searches;
+    std::vector<LocalSearchResult> optima(batch);
+    std::vector<bool> improved(batch, false);
+    // Indivíduo do lote com o mesmo ciclo de entrada, cujo resultado é copiado (batch quando não há)
+    std::vector<size_t> source(batch, batch);
 
-    for (auto &individual : population)
+    for (size_t i = 0; i < batch; i++)
     {
-        LocalSearchResult improved = local_search(weights, individual.path,
-                                                  method, improvement);
-        individual.path = improved.solution;
-        individual.cost = improved.cost;
-        individual.fitness = 1 / improved.cost;
+        Individual &individual = population[i];
+        if (individual.hash == 0)
+        {
+            individual.hash = tour_hash(individual.path);
+        }
+        input_hashes[i] = individual.hash;
+
+        if (best_solution != nullptr && !accepts_local_search(policy, individual.cost, best_solution->cost))
+        {
+            continue;
+        }
+        improved[i] = true;
+
+        auto cached = cache != nullptr ? cache->find(individual.hash) : LocalSearchCache::iterator();
+        if (cache != nullptr && cached != cache->end())
+        {
+            optima[i] = cached->second;
+            continue;
+        }
+
+        for (size_t k : searches)
+        {
+            if (input_hashes[k] == individual.hash)
+            {
+                source[i] = k;
+                break;
+            }
+        }
+        if (source[i] == batch)
+        {
+            searches.push_back(i);
+        }
     }
-};
 
-// (5) Renovar
-void renew_population(std::vector<Individual> &population, const std::vector<Individual> offsprings, const std::vector<std::vector<double>> &weights)
-{
-    population = renovation_elitism(population, offsprings, weights);
-};
+    auto search = [&](size_t i)
+    {
+        optima[i] = local_search(weights, population[i].path, policy.method, policy.improvement, policy.budget);
+    };
 
-// (6) Teste
-void evaluate_population(
-    const std::vector<std::vector<double>> &weights,
-    const std::vector<Individual> population,
-    Individual &best_solution,
-    int &stagnant_count)
-{
-    int best_index = 0;
+    if (pool != nullptr && searches.size() > 1)
+    {
+        for (size_t i : searches)
+        {
+            pool->submit([&search, i]() { search(i); });
+        }
+        pool->wait();
+    }
+    else
+    {
+        for (size_t i : searches)
+        {
+            search(i);
+        }
+    }
 
-    for (int i = 1; i < population.size(); i++)
+    for (size_t i = 0; i < batch; i++)
     {
-        if (population[i].cost < population[best_index].cost)
+        Individual &individual = population[i];
+        if (!improved[i])
+        {
+            individual.fitness = 1 / individual.cost;
+            if (best_solution != nullptr && individual.cost < best_solution->cost)
+            {
+                *best_solution = individual;
+            }
+            continue;
+        }
+
+        const LocalSearchResult &optimum = optima[source[i] != batch ? source[i] : i];
+        if (best_solution != nullptr && optimum.cost < best_solution->cost)
         {
-            best_index = i;
+            best_solution->path = optimum.solution;
+            best_solution->cost = optimum.cost;
+            best_solution->fitness = 1 / optimum.cost;
+            best_solution->hash = tour_hash(optimum.solution);
         }
+        write_back(individual, optimum, policy.write_back);
     }
 
-    if (population[best_index].cost < best_solution.cost)
+    if (cache != nullptr)
     {
-        best_solution = population[best_index];
-        stagnant_count = 0;
+        for (size_t i : searches)
+        {
+            if (cache->size() + 2 > LOCAL_SEARCH_CACHE_CAPACITY)
+            {
+                cache->clear();
+            }
+            (*cache)[input_hashes[i]] = optima[i];
+            // O ótimo local é um ponto fixo da busca local; um resultado interrompido pelo orçamento não é
+            if (optima[i].converged)
+            {
+                cache->emplace(tour_hash(optima[i].solution), optima[i]);
+            }
+        }
     }
-    else
+};
+
+// Busca local de todos os filhos até a convergência, com o método e a estratégia de melhoria informados
+void improve_individuas(
+    const std::vector<std::vector<double>> &weights,
+    std::vector<Individual> &population,
+    LocalSearchMethod method,
+    ImprovementType improvement,
+    LocalSearchCache *cache = nullptr,
+    WorkStealingPool *pool = nullptr)
+{
+    LocalSearchPolicy policy;
+    policy.method = method;
+    policy.improvement = improvement;
+    policy.threshold_percent = 0;
+    policy.budget = LocalSearchBudget();
+    improve_individuas(weights, population, policy, nullptr, cache, pool);
+};
+
+// (5) Renovar
+// Os filhos entram no lugar dos piores indivíduos, que voltam para offsprings e são reaproveitados
+// O seletor, se informado, é atualizado nas posições substituídas
+void renew_population(std::vector<Individual> &population, std::vector<Individual> &offsprings, OffspringWorkspace &workspace,
+                      ParentSelector *selector = nullptr)
+{
+    workspace.replaced.clear();
+    renovation_elitism(population, offsprings, workspace);
+    if (selector != nullptr)
     {
-        stagnant_count++;
+        selector->update(population, workspace.replaced);
     }
 };
 
 template <typename Node>
 TSPResult memetic_search(const IGraph<Node> &graph,
-                         const std::vector<std::vector<double>> &weights)
+                         const std::vector<std::vector<double>> &weights,
+                         const GeneticParameters &params = GeneticParameters(),
+                         const SolverControl &control = SolverControl())
 {
+    SolverMonitor monitor(control, weights);
+
+    if (params.seed != 0)
+    {
+        random_engine().seed(params.seed);
+    }
+
+    // As buscas locais dos filhos de cada geração rodam em paralelo quando há mais de uma thread e de um filho
+    size_t threads = params.threads > 0 ? params.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::unique_ptr<WorkStealingPool> pool;
+    if (threads > 1 && params.offspring_batch > 1)
+    {
+        pool = std::make_unique<WorkStealingPool>(threads);
+    }
+
+    CrossoverOperator crossover_operator = make_crossover_operator(params.crossover, weights);
+    LocalSearchCache local_search_cache;
+    OffspringWorkspace workspace;
+    std::vector<Individual> offspring;
 
     // (1) Inicio
-    std::vector<Individual> population = generate_initial_population(graph, weights);
+    std::vector<Individual> population = generate_initial_population(graph, weights, params.population_size);
 
     // (2) Fitness
-    calculate_initial_fitness(population, weights);
+    // A matriz plana é construída uma vez e usada na avaliação em lote da população e dos filhos
+    FlatWeights flat = flatten_weights(weights);
+    calculate_initial_fitness(population, flat);
+
+    ParentSelector selector(params);
+    selector.reset(population);
 
     // Inicializa variaveis de controle da execução
-    int stagnant_count = 0;
-    Individual best_solution = population[0];
+    Individual best_solution = *std::min_element(population.begin(), population.end(),
+        [](const Individual &a, const Individual &b) { return a.cost < b.cost; });
     std::pair<int, int> last_parents = {-1, -1};
+    monitor.improve(best_solution.path, best_solution.cost);
 
-    for (int i = 0; i < MAX_ITERATIONS_NUMBER && stagnant_count < MAX_STAGNANT_ITERATIONS_NUMBER; i++)
+    // A estagnação é controlada pelo SolverControl
+    for (int i = 0; i < params.max_iterations && !monitor.should_stop(); i++)
     {
         // (3) Nova Geração
-        std::vector<Individual> offspring = generate_new_individuas(population, weights, i, last_parents);
+        generate_new_individuas(population, weights, i, last_parents, offspring, workspace, crossover_operator, params, &selector, &flat);
 
         // (4) Busca local
-        improve_individuas(weights, offspring, LocalSearchMethod::SWAP, ImprovementType::FIRST_IMPROVEMENT);
+        // A melhor solução é acompanhada pelos resultados reais da busca local, pois no modo baldwiniano o
+        // custo dos indivíduos da população não corresponde aos seus caminhos
+        double previous_cost = best_solution.cost;
+        improve_individuas(weights, offspring, params.local_search_policy, &best_solution, &local_search_cache,
+                           pool.get());
 
         // (5) Renovar
-        renew_population(population, offspring, weights);
+        renew_population(population, offspring, workspace, &selector);
 
         // (6) Teste
-        evaluate_population(weights, population, best_solution, stagnant_count);
+        if (best_solution.cost < previous_cost)
+        {
+            monitor.improve(best_solution.path, best_solution.cost);
+        }
+        monitor.iteration();
     }
 
     TSPResult result;
     result.cost = best_solution.cost;
     result.path = best_solution.path;
+    result.lower_bound = monitor.lower_bound();
+    monitor.finish();
     return result;
 };
 
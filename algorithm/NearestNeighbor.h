@@ -6,22 +6,25 @@
 #include <algorithm>
 #include <utility>
 #include <cstddef>
+#include <chrono>
 
 #include "../graph/IGraph.h"
 #include "TSPResult.h"
 #include "LocalSearch.h"
+#include "SolverControl.h"
 
 /**
  * @brief Implementa o algoritmo do vizinho mais próximo para o problema do caixeiro viajante
  *
+ * @tparam Weight O tipo dos pesos (double, ou int32_t em ponto fixo)
  * @param graph_order Número de nós no grafo
  * @param weights A matriz de pesos
  * @param start_index O índice do nó inicial para o percurso
  * @return Um vetor de inteiros representando a ordem dos índices dos nós visitados no percurso.
  */
-template<typename Node>
+template<typename Node, typename Weight>
 std::vector<int> nearest_neighbor(const IGraph<Node>& graph, 
-    const std::vector<std::vector<double>>& weights, Node start_node) {
+    const std::vector<std::vector<Weight>>& weights, Node start_node) {
 
     std::vector<int> path;
     size_t graph_order = graph.get_order();
@@ -33,7 +36,9 @@ std::vector<int> nearest_neighbor(const IGraph<Node>& graph,
     path.push_back(current_index);
 
     while(path.size() < graph_order) {
-        double min_distance = std::numeric_limits<double>::infinity();
+        // Pesos inteiros não têm infinito; as arestas ausentes guardam o maior valor do tipo
+        Weight min_distance = std::numeric_limits<Weight>::has_infinity ?
+            std::numeric_limits<Weight>::infinity() : std::numeric_limits<Weight>::max();
         int next_index = -1;
 
         // Procura o nó mais próximo não visitado
@@ -62,26 +67,37 @@ std::vector<int> nearest_neighbor(const IGraph<Node>& graph,
 
 /**
  * @brief Combina o algoritmo do vizinho mais próximo com busca local
+ *
+ * Com pesos int32_t o custo retornado está na escala usada ao carregar a matriz. A busca local respeita o
+ * tempo limite e o cancelamento do controle, e o callback de melhora recebe o caminho final.
+ *
  * @tparam Node O tipo de dado dos nós no grafo
+ * @tparam Weight O tipo dos pesos (double, ou int32_t em ponto fixo)
  * @param graph O grafo para aplicação do algoritmo
  * @param weights A matriz de pesos
  * @param start_node O nó inicial para o percurso
  * @param method O método de busca local a ser utilizado
  * @param improvement O tipo de estratégia de melhoria a ser utilizada
+ * @param control O tempo limite, o cancelamento e o callback de melhora
  */
-template<typename Node>
+template<typename Node, typename Weight>
 TSPResult nearest_neighbor_local_search(const IGraph<Node>& graph,
-    const std::vector<std::vector<double>>& weights, Node start_node, 
-    LocalSearchMethod method, ImprovementType improvement) {
+    const std::vector<std::vector<Weight>>& weights, Node start_node, 
+    LocalSearchMethod method, ImprovementType improvement, const SolverControl& control = SolverControl()) {
 
+    auto start_time = std::chrono::steady_clock::now();
     std::vector<int> initial_path = nearest_neighbor(graph, weights, start_node);
 
-    LocalSearchResult local_search_result = local_search(weights, initial_path, method, improvement);
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    auto local_search_result = local_search(weights, initial_path, method, improvement,
+                                            local_search_budget(control, elapsed_ms));
 
     TSPResult result;
     result.cost = local_search_result.cost;
     result.path = local_search_result.solution;
 
+    report_result(control, result,
+                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count());
     return result;
 }
 
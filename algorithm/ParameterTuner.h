@@ -0,0 +1,121 @@
+#ifndef PARAMETER_TUNER_H
+#define PARAMETER_TUNER_H
+
+#include <vector>
+#include <chrono>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+// Orçamento total de tempo da corrida em milissegundos
+#define TUNER_BUDGET_MS 60000
+// Tempo de cada execução na primeira rodada, em milissegundos
+#define TUNER_BASE_RUN_TIME_MS 20
+// Fator de eliminação: a cada rodada resta 1/fator das configurações e o tempo por execução é multiplicado por ele
+#define TUNER_ELIMINATION_RATE 2
+
+/**
+ * @brief Parâmetros da corrida de configurações
+ */
+struct RacingParameters {
+    double budget_ms = TUNER_BUDGET_MS; // Orçamento total de tempo
+    double base_run_time_ms = TUNER_BASE_RUN_TIME_MS; // Tempo por execução na primeira rodada
+    int elimination_rate = TUNER_ELIMINATION_RATE; // Fator de eliminação entre rodadas
+};
+
+/**
+ * @brief Resultado de uma configuração na corrida
+ */
+template<typename Config>
+struct RacingCandidate {
+    Config config; // A configuração avaliada
+    double score; // Custo médio relativo ao melhor da última rodada disputada (1 = melhor em todas)
+    int rounds; // Número de rodadas disputadas
+
+    RacingCandidate() : score(std::numeric_limits<double>::infinity()), rounds(0) {}
+};
+
+/**
+ * @brief Compara configurações por corrida com eliminação sucessiva pela metade (successive halving)
+ *
+ * Em cada rodada todas as configurações restantes são executadas em todas as instâncias com o mesmo
+ * tempo por execução. A pontuação de uma configuração é a média, entre as instâncias, da razão entre o
+ * seu custo e o melhor custo da rodada naquela instância. Apenas a melhor fração 1/elimination_rate
+ * segue para a rodada seguinte, em que o tempo por execução é multiplicado por elimination_rate, de
+ * forma que cada rodada custa aproximadamente o mesmo. A corrida termina quando resta uma única
+ * configuração ou quando a próxima rodada não cabe no orçamento.
+ *
+ * @tparam Config O tipo da configuração
+ * @tparam Evaluate Função (config, índice da instância, tempo em ms) que executa o algoritmo e retorna o custo
+ * @param configs As configurações candidatas
+ * @param instances O número de instâncias
+ * @param evaluate A função de avaliação
+ * @param params Os parâmetros da corrida
+ * @return As configurações da melhor para a pior: as que duraram mais rodadas e, entre elas, as de menor pontuação
+ */
+template<typename Config, typename Evaluate>
+std::vector<RacingCandidate<Config>> successive_halving(const std::vector<Config>& configs, size_t instances,
+    Evaluate evaluate, const RacingParameters& params = RacingParameters()) {
+
+    auto start_time = std::chrono::steady_clock::now();
+    auto elapsed_ms = [&start_time]() {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+    };
+
+    std::vector<RacingCandidate<Config>> candidates(configs.size());
+    std::vector<size_t> alive;
+    for (size_t c = 0; c < configs.size(); c++) {
+        candidates[c].config = configs[c];
+        alive.push_back(c);
+    }
+
+    int elimination_rate = std::max(2, params.elimination_rate);
+    double run_time_ms = params.base_run_time_ms;
+
+    while (alive.size() > 1 && instances > 0) {
+        // A primeira rodada sempre é disputada; as demais apenas se couberem no orçamento
+        double estimated_ms = alive.size() * instances * run_time_ms;
+        if (candidates[alive[0]].rounds > 0 && elapsed_ms() + estimated_ms > params.budget_ms) {
+            break;
+        }
+
+        std::vector<std::vector<double>> costs(alive.size(), std::vector<double>(instances));
+        std::vector<double> best_costs(instances, std::numeric_limits<double>::infinity());
+
+        for (size_t instance = 0; instance < instances; instance++) {
+            for (size_t k = 0; k < alive.size(); k++) {
+                costs[k][instance] = evaluate(candidates[alive[k]].config, instance, run_time_ms);
+                best_costs[instance] = std::min(best_costs[instance], costs[k][instance]);
+            }
+        }
+
+        for (size_t k = 0; k < alive.size(); k++) {
+            double total = 0.0;
+            for (size_t instance = 0; instance < instances; instance++) {
+                total += best_costs[instance] > 0 ? costs[k][instance] / best_costs[instance] : 1.0;
+            }
+            candidates[alive[k]].score = total / instances;
+            candidates[alive[k]].rounds++;
+        }
+
+        // Mantém apenas a melhor fração das configurações
+        std::stable_sort(alive.begin(), alive.end(), [&candidates](size_t a, size_t b) {
+            return candidates[a].score < candidates[b].score;
+        });
+        alive.resize((alive.size() + elimination_rate - 1) / elimination_rate);
+
+        run_time_ms *= elimination_rate;
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+        [](const RacingCandidate<Config>& a, const RacingCandidate<Config>& b) {
+            if (a.rounds != b.rounds) {
+                return a.rounds > b.rounds;
+            }
+            return a.score < b.score;
+        });
+
+    return candidates;
+}
+
+#endif // PARAMETER_TUNER_H
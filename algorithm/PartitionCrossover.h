@@ -0,0 +1,153 @@
+#ifndef PARTITION_CROSSOVER_H
+#define PARTITION_CROSSOVER_H
+
+#include <vector>
+#include <numeric>
+#include <cstddef>
+
+/**
+ * @brief Encontra o representante do conjunto de um nó (union-find com compressão de caminho)
+ * @param parent O vetor de pais do union-find
+ * @param node O nó consultado
+ * @return O representante do conjunto do nó
+ */
+int find_component(std::vector<int>& parent, int node) {
+    while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+    return node;
+}
+
+/**
+ * @brief Realiza o crossover de partição generalizado (GPX) entre dois caminhos
+ *
+ * As arestas comuns aos dois pais são removidas do grafo união, e os componentes conexos restantes
+ * formam as partições. Um componente atravessado pelo caminho por exatamente duas arestas (comuns)
+ * é percorrido pelos dois pais como um único trecho com as mesmas extremidades, então o trecho de
+ * qualquer um dos pais pode ser usado no filho. Para cada um desses componentes o filho herda o
+ * trecho mais barato; o restante do caminho vem do primeiro pai. Todo o processo é linear no número
+ * de nós.
+ *
+ * @param first O primeiro pai, que fornece as partes não recombináveis
+ * @param second O segundo pai
+ * @param weights A matriz de pesos
+ * @return O caminho do filho; igual ao primeiro pai quando não há partição recombinável
+ */
+std::vector<int> partition_crossover(const std::vector<int>& first, const std::vector<int>& second,
+    const std::vector<std::vector<double>>& weights) {
+
+    int total_nodes = first.size();
+    if (total_nodes < 4) {
+        return first;
+    }
+
+    // Vizinhos de cada nó no segundo pai
+    std::vector<int> second_next(total_nodes), second_prev(total_nodes);
+    for (int k = 0; k < total_nodes; k++) {
+        second_next[second[k]] = second[(k + 1) % total_nodes];
+        second_prev[second[(k + 1) % total_nodes]] = second[k];
+    }
+
+    // Vizinho seguinte de cada nó no primeiro pai
+    std::vector<int> first_next(total_nodes);
+    for (int k = 0; k < total_nodes; k++) {
+        first_next[first[k]] = first[(k + 1) % total_nodes];
+    }
+
+    auto is_shared = [&](int a, int b) {
+        return second_next[a] == b || second_prev[a] == b;
+    };
+
+    // Une os nós ligados por arestas não comuns de qualquer um dos pais
+    std::vector<int> parent(total_nodes);
+    std::iota(parent.begin(), parent.end(), 0);
+
+    for (int k = 0; k < total_nodes; k++) {
+        int a = first[k], b = first[(k + 1) % total_nodes];
+        if (!is_shared(a, b)) {
+            parent[find_component(parent, a)] = find_component(parent, b);
+        }
+        int c = second[k], d = second[(k + 1) % total_nodes];
+        if (first_next[c] != d && first_next[d] != c) {
+            parent[find_component(parent, c)] = find_component(parent, d);
+        }
+    }
+
+    std::vector<int> component(total_nodes);
+    for (int node = 0; node < total_nodes; node++) {
+        component[node] = find_component(parent, node);
+    }
+
+    // Conta quantas arestas do caminho cruzam a fronteira de cada componente
+    std::vector<int> portals(total_nodes, 0);
+    int start = -1;
+    for (int k = 0; k < total_nodes; k++) {
+        int a = first[k], b = first[(k + 1) % total_nodes];
+        if (component[a] != component[b]) {
+            portals[component[a]]++;
+            portals[component[b]]++;
+            start = (k + 1) % total_nodes;
+        }
+    }
+
+    // Um único componente não admite recombinação
+    if (start == -1) {
+        return first;
+    }
+
+    std::vector<int> child;
+    child.reserve(total_nodes);
+    bool changed = false;
+
+    // Percorre o primeiro pai a partir de uma fronteira, trecho a trecho
+    int k = 0;
+    while (k < total_nodes) {
+        int entry = first[(start + k) % total_nodes];
+        int current_component = component[entry];
+
+        // Limites do trecho do componente no primeiro pai
+        int length = 1;
+        double first_cost = 0.0;
+        while (k + length < total_nodes &&
+               component[first[(start + k + length) % total_nodes]] == current_component) {
+            first_cost += weights[first[(start + k + length - 1) % total_nodes]]
+                                 [first[(start + k + length) % total_nodes]];
+            length++;
+        }
+
+        bool recombinable = portals[current_component] == 2 && length > 1;
+
+        if (recombinable) {
+            // Trecho do segundo pai com a mesma entrada, orientado para dentro do componente
+            bool forward = component[second_next[entry]] == current_component;
+            std::vector<int> segment = {entry};
+            double second_cost = 0.0;
+
+            for (int step = 1; step < length; step++) {
+                int previous = segment.back();
+                int next = forward ? second_next[previous] : second_prev[previous];
+                second_cost += weights[previous][next];
+                segment.push_back(next);
+            }
+
+            // A saída do trecho do segundo pai precisa coincidir com a do primeiro
+            int exit = first[(start + k + length - 1) % total_nodes];
+            if (segment.back() == exit && second_cost < first_cost) {
+                child.insert(child.end(), segment.begin(), segment.end());
+                changed = true;
+                k += length;
+                continue;
+            }
+        }
+
+        for (int step = 0; step < length; step++) {
+            child.push_back(first[(start + k + step) % total_nodes]);
+        }
+        k += length;
+    }
+
+    return changed ? child : first;
+}
+
+#endif // PARTITION_CROSSOVER_H
@@ -0,0 +1,329 @@
+#ifndef PIPELINED_MEMETIC_SEARCH_H
+#define PIPELINED_MEMETIC_SEARCH_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "GeneticSearch.h"
+#include "MemeticSearch.h"
+#include "LocalSearch.h"
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/LockFreeQueue.h"
+#include "../utils/TourHash.h"
+
+// Número de threads produtoras (seleção, cruzamento e mutação)
+#define PIPELINE_PRODUCERS 1
+// Threads de busca local (0 utiliza os núcleos restantes, com no mínimo uma)
+#define PIPELINE_WORKERS 0
+// Capacidade de cada fila do pipeline
+#define PIPELINE_QUEUE_CAPACITY 64
+// Tentativas, cedendo a thread entre elas, antes de uma thread ociosa do pipeline estacionar
+#define PIPELINE_SPIN_ATTEMPTS 64
+// Tempo máximo, em milissegundos, que uma thread fica estacionada antes de reavaliar a parada
+#define PIPELINE_PARK_MS 1.0
+
+/**
+ * @brief Parâmetros do pipeline do algoritmo memético assíncrono
+ */
+struct PipelineParameters {
+    int producers = PIPELINE_PRODUCERS; // Threads que geram candidatos
+    int workers = PIPELINE_WORKERS; // Threads que aplicam a busca local
+    size_t queue_capacity = PIPELINE_QUEUE_CAPACITY; // Capacidade das filas de candidatos e de resultados
+};
+
+/**
+ * @class PipelineSignal
+ * @brief Estaciona as threads que esperam por uma fila do pipeline até que outra thread a altere
+ *
+ * Quem altera a fila chama notify(), que incrementa um contador de eventos e só toma a trava quando há
+ * threads estacionadas. Quem espera lê o contador antes de cada tentativa e, esgotadas as tentativas
+ * rápidas, dorme até que o contador mude, então uma notificação entre a tentativa e o sono não se perde.
+ */
+class PipelineSignal {
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::atomic<unsigned int> epoch;
+        std::atomic<int> sleepers;
+
+    public:
+        PipelineSignal() : epoch(0), sleepers(0) {}
+
+        /**
+         * @brief Avisa as threads estacionadas de que a fila mudou
+         */
+        void notify() {
+            epoch++;
+            if (sleepers > 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                condition.notify_all();
+            }
+        }
+
+        /**
+         * @brief Repete uma tentativa até que ela tenha sucesso ou que a parada seja pedida
+         *
+         * As primeiras PIPELINE_SPIN_ATTEMPTS tentativas apenas cedem a thread; depois a thread estaciona
+         * até a próxima notify(), acordando a cada PIPELINE_PARK_MS para reavaliar a parada.
+         *
+         * @param attempt A tentativa (um try_pop ou try_push), que retorna true em caso de sucesso
+         * @param stop Retorna true quando a espera deve ser abandonada
+         * @return true se a tentativa teve sucesso, false se a parada foi pedida
+         */
+        template<typename Attempt, typename Stop>
+        bool wait(Attempt attempt, Stop stop) {
+            for (int spin = 0; ; spin++) {
+                unsigned int observed = epoch;
+                if (attempt()) {
+                    return true;
+                }
+                if (stop()) {
+                    return false;
+                }
+                if (spin < PIPELINE_SPIN_ATTEMPTS) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                sleepers++;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    condition.wait_for(lock, std::chrono::duration<double, std::milli>(PIPELINE_PARK_MS),
+                        [&]() { return epoch != observed; });
+                }
+                sleepers--;
+            }
+        }
+};
+
+/**
+ * @brief Filho melhorado publicado pelas threads de busca local para a integração
+ */
+struct PipelineResult {
+    Individual offspring; // O filho após a política de busca local
+    LocalSearchResult optimum; // O ótimo local, guardado apenas quando o filho não o recebeu (modo baldwiniano)
+};
+
+/**
+ * @brief Executa o algoritmo memético em regime estacionário, sem barreira entre gerações
+ *
+ * Threads produtoras selecionam pais, aplicam cruzamento e mutação e publicam os candidatos em uma fila
+ * sem travas. Threads de busca local consomem os candidatos e publicam os ótimos locais em uma segunda
+ * fila, e a thread que chama a função integra cada resultado à população com renovation_elitism. A busca
+ * local segue params.local_search_policy, com o filtro de custo aplicado sobre a melhor solução já integrada. Uma
+ * busca local longa ocupa apenas a sua thread enquanto as demais continuam trabalhando. Os produtores
+ * leem a população sob uma trava compartilhada, tomada com exclusividade apenas durante a renovação.
+ * Threads sem trabalho (fila vazia ou cheia) estacionam em um PipelineSignal após algumas tentativas, de
+ * forma que a integração e os produtores não disputam os núcleos com a busca local.
+ *
+ * Cada filho integrado conta como uma iteração (max_iterations e critério de estagnação). Com params.seed
+ * não nulo, a população inicial e cada produtora usam sementes fixas, mas a ordem de integração depende
+ * do escalonamento, então os resultados não são exatamente reproduzíveis.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param params Os parâmetros do algoritmo genético
+ * @param pipeline Os parâmetros do pipeline
+ * @param control Os critérios de parada e o callback de melhora
+ * @return O melhor caminho encontrado, seu custo e o limitante inferior da instância
+ */
+template<typename Node>
+TSPResult pipelined_memetic_search(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights,
+    const GeneticParameters& params = GeneticParameters(),
+    const PipelineParameters& pipeline = PipelineParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+
+    if (params.seed != 0) {
+        random_engine().seed(params.seed);
+    }
+
+    CrossoverOperator crossover_operator = make_crossover_operator(params.crossover, weights);
+
+    std::vector<Individual> population = generate_initial_population(graph, weights, params.population_size);
+    // A matriz plana é construída uma vez e usada na população inicial e nos custos dos candidatos
+    FlatWeights flat = flatten_weights(weights);
+    calculate_initial_fitness(population, flat);
+
+    ParentSelector selector(params);
+    selector.reset(population);
+
+    Individual best_solution = *std::min_element(population.begin(), population.end(),
+        [](const Individual& a, const Individual& b) { return a.cost < b.cost; });
+    monitor.improve(best_solution.path, best_solution.cost);
+
+    int producers = std::max(1, pipeline.producers);
+    int workers = pipeline.workers;
+    if (workers <= 0) {
+        workers = std::max(1, (int)std::thread::hardware_concurrency() - producers);
+    }
+
+    const LocalSearchPolicy& policy = params.local_search_policy;
+    MpmcQueue<Individual> candidates(pipeline.queue_capacity);
+    MpmcQueue<PipelineResult> results(pipeline.queue_capacity);
+    std::atomic<double> best_cost(best_solution.cost);
+    std::shared_mutex population_mutex;
+    std::mutex cache_mutex;
+    LocalSearchCache local_search_cache;
+    std::atomic<bool> stopping(false);
+    auto stopped = [&stopping]() { return stopping.load(std::memory_order_relaxed); };
+
+    // Um sinal para cada condição esperada: elementos disponíveis e espaço livre em cada fila
+    PipelineSignal candidates_ready, candidates_space, results_ready, results_space;
+
+    // Publica um elemento, esperando enquanto a fila estiver cheia, e avisa os consumidores
+    auto publish = [&stopped](auto& queue, PipelineSignal& ready, PipelineSignal& space, auto& element) {
+        if (space.wait([&]() { return queue.try_push(std::move(element)); }, stopped)) {
+            ready.notify();
+        }
+    };
+
+    auto produce = [&](int producer) {
+        // Cada produtora tem a própria semente, distinta da usada na população inicial
+        if (params.seed != 0) {
+            random_engine().seed(params.seed + 1 + producer);
+        }
+
+        OffspringWorkspace workspace;
+        std::pair<int, int> last_parents = {-1, -1};
+        Individual candidate;
+
+        for (int iteration = 0; !stopping.load(std::memory_order_relaxed); iteration++) {
+            {
+                std::shared_lock<std::shared_mutex> lock(population_mutex);
+                std::pair<int, int> parents = selector.select(population, iteration, last_parents);
+                crossover(crossover_operator, population[parents.first].path, population[parents.second].path,
+                          weights, candidate.path, workspace);
+            }
+
+            candidate.hash = tour_hash(candidate.path);
+            apply_mutation(candidate, params.mutation_percent);
+            candidate.cost = calculate_path_cost(flat, candidate.path.data(), candidate.path.size());
+            publish(candidates, candidates_ready, candidates_space, candidate);
+        }
+    };
+
+    auto improve = [&]() {
+        PipelineResult result;
+        Individual& candidate = result.offspring;
+
+        while (!stopped()) {
+            if (!candidates_ready.wait([&]() { return candidates.try_pop(candidate); }, stopped)) {
+                break;
+            }
+            candidates_space.notify();
+
+            result.optimum.solution.clear();
+            if (!accepts_local_search(policy, candidate.cost, best_cost.load(std::memory_order_relaxed))) {
+                candidate.fitness = 1 / candidate.cost;
+                publish(results, results_ready, results_space, result);
+                continue;
+            }
+
+            uint64_t input_hash = candidate.hash;
+            bool cached = false;
+            {
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                auto entry = local_search_cache.find(input_hash);
+                if (entry != local_search_cache.end()) {
+                    result.optimum = entry->second;
+                    cached = true;
+                }
+            }
+
+            if (!cached) {
+                result.optimum = local_search(weights, candidate.path, policy.method, policy.improvement,
+                                              policy.budget);
+                std::lock_guard<std::mutex> lock(cache_mutex);
+                if (local_search_cache.size() + 2 > LOCAL_SEARCH_CACHE_CAPACITY) {
+                    local_search_cache.clear();
+                }
+                local_search_cache[input_hash] = result.optimum;
+                // O ótimo local é um ponto fixo da busca local; um resultado interrompido pelo orçamento não é
+                if (result.optimum.converged) {
+                    local_search_cache.emplace(tour_hash(result.optimum.solution), result.optimum);
+                }
+            }
+
+            write_back(candidate, result.optimum, policy.write_back);
+            if (policy.write_back == WriteBackType::LAMARCKIAN) {
+                result.optimum.solution.clear();
+            }
+            publish(results, results_ready, results_space, result);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back(produce, p);
+    }
+    for (int w = 0; w < workers; w++) {
+        threads.emplace_back(improve);
+    }
+
+    // Integração: a thread que chama a função é a única que altera a população
+    OffspringWorkspace workspace;
+    std::vector<Individual> offspring(1);
+    PipelineResult improved;
+    long long integrated = 0;
+
+    while (integrated < params.max_iterations && !monitor.should_stop()) {
+        if (!results_ready.wait([&]() { return results.try_pop(improved); },
+                                [&monitor]() { return monitor.should_stop(); })) {
+            break;
+        }
+        results_space.notify();
+        std::swap(offspring[0], improved.offspring);
+
+        // A melhor solução vem do ótimo local quando o filho manteve o próprio caminho (modo baldwiniano)
+        if (offspring[0].cost < best_solution.cost) {
+            if (improved.optimum.solution.empty()) {
+                best_solution = offspring[0];
+            } else {
+                best_solution.path = std::move(improved.optimum.solution);
+                best_solution.cost = improved.optimum.cost;
+                best_solution.fitness = 1 / best_solution.cost;
+                best_solution.hash = tour_hash(best_solution.path);
+            }
+            best_cost.store(best_solution.cost, std::memory_order_relaxed);
+            monitor.improve(best_solution.path, best_solution.cost);
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(population_mutex);
+            renew_population(population, offspring, workspace, &selector);
+        }
+
+        integrated++;
+        monitor.iteration();
+    }
+
+    stopping = true;
+    for (PipelineSignal* signal : {&candidates_ready, &candidates_space, &results_ready, &results_space}) {
+        signal->notify();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    TSPResult result;
+    result.cost = best_solution.cost;
+    result.path = best_solution.path;
+    result.lower_bound = monitor.lower_bound();
+    monitor.finish();
+    return result;
+}
+
+#endif // PIPELINED_MEMETIC_SEARCH_H
@@ -0,0 +1,217 @@
+#ifndef POPULATION_ARENA_H
+#define POPULATION_ARENA_H
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+#include "../utils/TourHash.h"
+#include "../utils/TSPUtils.h"
+
+/**
+ * @brief Visão somente leitura de um caminho guardado em uma PopulationArena, sem cópia
+ * @tparam Index O tipo inteiro em que os nós são guardados
+ */
+template<typename Index>
+class TourView {
+    private:
+        const Index* data;
+        size_t length;
+
+    public:
+        TourView(const Index* data, size_t length) : data(data), length(length) {}
+
+        size_t size() const {
+            return length;
+        }
+
+        int operator[](size_t position) const {
+            return data[position];
+        }
+
+        const Index* begin() const {
+            return data;
+        }
+
+        const Index* end() const {
+            return data + length;
+        }
+};
+
+/**
+ * @class PopulationArena
+ * @brief População do algoritmo genético com todos os caminhos em um único buffer contíguo
+ *
+ * Cada vaga ocupa uma linha de order nós no buffer. As vagas 0..size()-1 são a população e as vagas
+ * seguintes são reservas onde os filhos são montados antes da renovação. Vagas lógicas apontam para
+ * linhas físicas, então substituir um indivíduo por um filho é apenas uma troca de índices, sem copiar o
+ * caminho. Custo, fitness e hash ficam em vetores paralelos, e a arena mantém a contagem dos hashes
+ * presentes na população para rejeitar clones em O(1).
+ *
+ * @tparam Index O tipo inteiro em que os nós são guardados (uint16_t quando a instância permite)
+ */
+template<typename Index>
+class PopulationArena {
+    private:
+        size_t population_size;
+        size_t total_nodes;
+        std::vector<Index> tours;
+        std::vector<size_t> rows;
+        std::vector<double> costs;
+        std::vector<double> fitnesses;
+        std::vector<uint64_t> hashes;
+        std::unordered_map<uint64_t, int> census;
+        // Buffers reutilizados pela avaliação em lote
+        std::vector<const Index*> batch_paths;
+        std::vector<double> batch_costs;
+
+        // Atualiza a contagem de hashes quando a vaga pertence à população (hash 0 indica vaga vazia)
+        void count(size_t slot, int delta) {
+            uint64_t hash = hashes[rows[slot]];
+            if (slot >= population_size || hash == 0) {
+                return;
+            }
+
+            int& amount = census[hash];
+            amount += delta;
+            if (amount <= 0) {
+                census.erase(hash);
+            }
+        }
+
+    public:
+        /**
+         * @brief Reserva a arena para uma população
+         * @param population_size O número de indivíduos da população
+         * @param order O número de nós de cada caminho
+         * @param spare_slots O número de vagas reservas para filhos
+         */
+        PopulationArena(size_t population_size, size_t order, size_t spare_slots)
+            : population_size(population_size), total_nodes(order),
+              tours((population_size + spare_slots) * order), rows(population_size + spare_slots),
+              costs(population_size + spare_slots, 0.0), fitnesses(population_size + spare_slots, 0.0),
+              hashes(population_size + spare_slots, 0) {
+
+            for (size_t slot = 0; slot < rows.size(); slot++) {
+                rows[slot] = slot;
+            }
+            census.reserve(population_size);
+        }
+
+        /**
+         * @brief Indica se o tipo Index comporta os nós de uma instância
+         * @param order O número de nós da instância
+         */
+        static bool fits(size_t order) {
+            return order == 0 || order - 1 <= std::numeric_limits<Index>::max();
+        }
+
+        /**
+         * @brief Retorna o número de indivíduos da população (sem as vagas reservas)
+         */
+        size_t size() const {
+            return population_size;
+        }
+
+        /**
+         * @brief Retorna o número total de vagas, incluindo as reservas
+         */
+        size_t slots() const {
+            return rows.size();
+        }
+
+        /**
+         * @brief Retorna o número de nós de cada caminho
+         */
+        size_t order() const {
+            return total_nodes;
+        }
+
+        /**
+         * @brief Retorna uma visão do caminho de uma vaga, válida até a próxima escrita nessa vaga
+         */
+        TourView<Index> tour(size_t slot) const {
+            return TourView<Index>(tours.data() + rows[slot] * total_nodes, total_nodes);
+        }
+
+        /**
+         * @brief Retorna uma cópia do caminho de uma vaga
+         */
+        std::vector<int> path(size_t slot) const {
+            TourView<Index> view = tour(slot);
+            return std::vector<int>(view.begin(), view.end());
+        }
+
+        double cost(size_t slot) const {
+            return costs[rows[slot]];
+        }
+
+        double fitness(size_t slot) const {
+            return fitnesses[rows[slot]];
+        }
+
+        uint64_t hash(size_t slot) const {
+            return hashes[rows[slot]];
+        }
+
+        /**
+         * @brief Grava um caminho em uma vaga
+         *
+         * O custo e o fitness da vaga só são atualizados por evaluate().
+         *
+         * @param slot A vaga
+         * @param path O caminho
+         * @param hash O hash do caminho
+         */
+        void store(size_t slot, const std::vector<int>& path, uint64_t hash) {
+            count(slot, -1);
+            std::copy(path.begin(), path.end(), tours.begin() + rows[slot] * total_nodes);
+            hashes[rows[slot]] = hash;
+            count(slot, 1);
+        }
+
+        /**
+         * @brief Calcula o custo e o fitness dos caminhos de vagas consecutivas diretamente no buffer
+         *
+         * Os caminhos são avaliados em lote por calculate_path_costs sobre a matriz plana.
+         *
+         * @param first A primeira vaga
+         * @param count O número de vagas
+         * @param weights A matriz de pesos plana
+         */
+        void evaluate(size_t first, size_t count, const FlatWeights& weights) {
+            batch_paths.clear();
+            for (size_t slot = first; slot < first + count; slot++) {
+                batch_paths.push_back(tours.data() + rows[slot] * total_nodes);
+            }
+            calculate_path_costs(weights, batch_paths, total_nodes, batch_costs);
+
+            for (size_t k = 0; k < count; k++) {
+                costs[rows[first + k]] = batch_costs[k];
+                fitnesses[rows[first + k]] = 1 / batch_costs[k];
+            }
+        }
+
+        /**
+         * @brief Troca o conteúdo de duas vagas trocando apenas as linhas para as quais apontam
+         */
+        void swap_slots(size_t first, size_t second) {
+            count(first, -1);
+            count(second, -1);
+            std::swap(rows[first], rows[second]);
+            count(first, 1);
+            count(second, 1);
+        }
+
+        /**
+         * @brief Indica se algum indivíduo da população tem o hash informado
+         */
+        bool contains(uint64_t hash) const {
+            return census.count(hash) > 0;
+        }
+};
+
+#endif // POPULATION_ARENA_H
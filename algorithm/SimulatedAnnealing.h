@@ -0,0 +1,280 @@
+#ifndef SIMULATED_ANNEALING_H
+#define SIMULATED_ANNEALING_H
+
+#include <vector>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+
+#include "../graph/IGraph.h"
+#include "NearestNeighbor.h"
+#include "LocalSearch.h"
+#include "TSPResult.h"
+#include "SolverControl.h"
+#include "../utils/TSPUtils.h"
+
+// Número máximo de movimentos propostos por cadeia
+#define SA_MAX_ITERATIONS 2000000
+// Número de cadeias independentes (0 utiliza uma por núcleo disponível)
+#define SA_CHAINS 0
+// Probabilidade de aceitar um movimento de piora médio na temperatura inicial
+#define SA_INITIAL_ACCEPTANCE 0.5
+// Quantidade de movimentos sorteados para calibrar a temperatura inicial
+#define SA_CALIBRATION_SAMPLES 200
+// Fator de resfriamento aplicado ao final de cada época
+#define SA_COOLING_RATE 0.95
+// Movimentos propostos por época, em múltiplos do número de nós
+#define SA_EPOCH_LENGTH_FACTOR 10
+// Épocas consecutivas sem melhora da melhor solução antes do reaquecimento
+#define SA_REHEAT_EPOCHS 50
+// Fração da temperatura inicial utilizada no reaquecimento
+#define SA_REHEAT_FACTOR 0.3
+
+/**
+ * @brief Parâmetros do recozimento simulado
+ */
+struct AnnealingParameters {
+    long long max_iterations = SA_MAX_ITERATIONS; // Movimentos propostos por cadeia
+    int chains = SA_CHAINS; // Número de cadeias executadas em paralelo
+    double initial_acceptance = SA_INITIAL_ACCEPTANCE; // Aceitação desejada na temperatura inicial
+    double cooling_rate = SA_COOLING_RATE; // Fator de resfriamento por época
+    int reheat_epochs = SA_REHEAT_EPOCHS; // Épocas sem melhora antes de reaquecer
+    double reheat_factor = SA_REHEAT_FACTOR; // Temperatura de reaquecimento relativa à inicial
+    unsigned int seed = 0; // Semente base das cadeias (0 sorteia uma semente)
+    std::vector<LocalSearchMethod> methods = {
+        LocalSearchMethod::SWAP,
+        LocalSearchMethod::SHIFT,
+        LocalSearchMethod::INVERT
+    }; // Vizinhanças utilizadas para propor movimentos
+};
+
+/**
+ * @brief Estrutura que representa um movimento proposto pelo recozimento
+ */
+struct AnnealingMove {
+    LocalSearchMethod method;
+    size_t i;
+    size_t j;
+};
+
+/**
+ * @brief Sorteia um movimento válido entre as vizinhanças configuradas
+ * @param methods As vizinhanças disponíveis
+ * @param path_size O número de nós do caminho
+ * @param rng O gerador de números aleatórios
+ * @return O movimento sorteado
+ */
+AnnealingMove random_move(const std::vector<LocalSearchMethod>& methods, size_t path_size, std::mt19937& rng) {
+    std::uniform_int_distribution<size_t> method_distribution(0, methods.size() - 1);
+    std::uniform_int_distribution<size_t> index_distribution(0, path_size - 1);
+
+    AnnealingMove move;
+    move.method = methods[method_distribution(rng)];
+    move.i = index_distribution(rng);
+
+    // Sorteia j diferente de i
+    do {
+        move.j = index_distribution(rng);
+    } while (move.j == move.i);
+
+    // Apenas o deslocamento depende da ordem dos índices
+    if (move.method != LocalSearchMethod::SHIFT && move.i > move.j) {
+        std::swap(move.i, move.j);
+    }
+
+    return move;
+}
+
+/**
+ * @brief Calibra a temperatura inicial a partir da média das pioras de movimentos aleatórios
+ *
+ * A temperatura é escolhida de forma que uma piora média seja aceita com a probabilidade desejada.
+ *
+ * @param weights A matriz de pesos
+ * @param path O caminho inicial
+ * @param params Os parâmetros do recozimento
+ * @param symmetric Indica se a matriz de pesos é simétrica
+ * @param rng O gerador de números aleatórios
+ * @return A temperatura inicial
+ */
+double calibrate_temperature(const std::vector<std::vector<double>>& weights, const std::vector<int>& path,
+    const AnnealingParameters& params, bool symmetric, std::mt19937& rng) {
+
+    double uphill_sum = 0.0;
+    int uphill_count = 0;
+
+    for (int sample = 0; sample < SA_CALIBRATION_SAMPLES; sample++) {
+        AnnealingMove move = random_move(params.methods, path.size(), rng);
+        double delta = move_delta(move.method, weights, path, move.i, move.j, symmetric);
+
+        if (delta > 0 && std::isfinite(delta)) {
+            uphill_sum += delta;
+            uphill_count++;
+        }
+    }
+
+    if (uphill_count == 0) {
+        return 1.0;
+    }
+
+    return -(uphill_sum / uphill_count) / std::log(params.initial_acceptance);
+}
+
+/**
+ * @brief Executa uma cadeia de recozimento simulado
+ *
+ * Cada movimento proposto é avaliado pela sua variação de custo em O(1), e o caminho só é modificado
+ * quando o movimento é aceito. O resfriamento é adaptativo: épocas com aceitação alta resfriam mais
+ * rápido e épocas com aceitação baixa resfriam mais devagar. Quando a melhor solução estagna, a cadeia
+ * é reaquecida a partir da melhor solução encontrada.
+ *
+ * @param weights A matriz de pesos
+ * @param initial_path O caminho inicial
+ * @param params Os parâmetros do recozimento
+ * @param seed A semente do gerador de números aleatórios da cadeia
+ * @param monitor O acompanhamento compartilhado entre as cadeias, consultado ao final de cada época
+ * @return O melhor caminho encontrado pela cadeia e seu custo
+ */
+TSPResult anneal_chain(const std::vector<std::vector<double>>& weights, const std::vector<int>& initial_path,
+    const AnnealingParameters& params, unsigned int seed, SolverMonitor& monitor) {
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> probability(0.0, 1.0);
+    bool symmetric = is_symmetric(weights);
+    size_t path_size = initial_path.size();
+
+    std::vector<int> current_path = initial_path;
+    double current_cost = calculate_path_cost(weights, current_path);
+
+    TSPResult best;
+    best.path = current_path;
+    best.cost = current_cost;
+
+    if (path_size < 3 || params.methods.empty()) {
+        return best;
+    }
+
+    double initial_temperature = calibrate_temperature(weights, current_path, params, symmetric, rng);
+    double temperature = initial_temperature;
+    long long epoch_length = std::max<long long>(100, SA_EPOCH_LENGTH_FACTOR * (long long)path_size);
+    int stagnant_epochs = 0;
+
+    for (long long iteration = 0; iteration < params.max_iterations; ) {
+        long long accepted = 0;
+        long long proposed = 0;
+        bool improved = false;
+
+        // Uma época é executada na mesma temperatura
+        for (; proposed < epoch_length && iteration < params.max_iterations; proposed++, iteration++) {
+            AnnealingMove move = random_move(params.methods, path_size, rng);
+            double delta = move_delta(move.method, weights, current_path, move.i, move.j, symmetric);
+
+            // Critério de Metropolis
+            if (delta <= 0 || probability(rng) < std::exp(-delta / temperature)) {
+                apply_move(move.method, current_path, move.i, move.j);
+                current_cost += delta;
+                accepted++;
+
+                if (current_cost < best.cost - IMPROVEMENT_EPSILON) {
+                    best.path = current_path;
+                    best.cost = current_cost;
+                    improved = true;
+                }
+            }
+        }
+
+        // A melhora da época é informada uma única vez, e a parada vale para todas as cadeias
+        if (improved) {
+            monitor.improve(best.path, best.cost);
+        }
+        monitor.iteration();
+        if (monitor.should_stop()) {
+            break;
+        }
+
+        stagnant_epochs = improved ? 0 : stagnant_epochs + 1;
+
+        // Reaquecimento a partir da melhor solução quando a busca estagna
+        if (stagnant_epochs >= params.reheat_epochs) {
+            current_path = best.path;
+            current_cost = calculate_path_cost(weights, current_path);
+            temperature = initial_temperature * params.reheat_factor;
+            stagnant_epochs = 0;
+            continue;
+        }
+
+        // Resfriamento adaptativo conforme a taxa de aceitação da época
+        double acceptance_rate = (double)accepted / proposed;
+        if (acceptance_rate > 0.5) {
+            temperature *= params.cooling_rate * params.cooling_rate;
+        } else if (acceptance_rate < 0.05) {
+            temperature *= std::sqrt(params.cooling_rate);
+        } else {
+            temperature *= params.cooling_rate;
+        }
+    }
+
+    // Recalcula o custo para eliminar o acúmulo de erros de arredondamento das variações
+    best.cost = calculate_path_cost(weights, best.path);
+
+    return best;
+}
+
+/**
+ * @brief Executa o recozimento simulado com cadeias independentes em paralelo
+ *
+ * Todas as cadeias partem da solução do vizinho mais próximo e diferem apenas pela semente. Cada cadeia
+ * guarda apenas a solução corrente e a melhor solução, e o resultado final é a melhor entre as cadeias.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param start_node O nó inicial da solução construtiva
+ * @param params Os parâmetros do recozimento
+ * @param control Os critérios de parada e o callback de melhora; a estagnação é contada em épocas
+ * @return O melhor caminho encontrado, seu custo e o limitante inferior da instância
+ */
+template<typename Node>
+TSPResult simulated_annealing(const IGraph<Node>& graph,
+    const std::vector<std::vector<double>>& weights, Node start_node,
+    const AnnealingParameters& params = AnnealingParameters(),
+    const SolverControl& control = SolverControl()) {
+
+    SolverMonitor monitor(control, weights);
+    std::vector<int> initial_path = nearest_neighbor(graph, weights, start_node);
+    monitor.improve(initial_path, calculate_path_cost(weights, initial_path));
+
+    int chains = params.chains;
+    if (chains <= 0) {
+        chains = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    unsigned int base_seed = params.seed != 0 ? params.seed : std::random_device{}();
+
+    // Cada cadeia escreve apenas na sua posição do vetor de resultados
+    std::vector<TSPResult> chain_results(chains);
+    std::vector<std::thread> threads;
+
+    for (int chain = 0; chain < chains; chain++) {
+        threads.emplace_back([&, chain]() {
+            chain_results[chain] = anneal_chain(weights, initial_path, params, base_seed + chain, monitor);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Redução: o melhor resultado entre as cadeias
+    auto best = std::min_element(chain_results.begin(), chain_results.end(),
+        [](const TSPResult& a, const TSPResult& b) { return a.cost < b.cost; });
+
+    TSPResult result = *best;
+    result.lower_bound = monitor.lower_bound();
+    monitor.finish();
+    return result;
+}
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef SMALL_TSP_H
+#define SMALL_TSP_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+#include "TSPResult.h"
+
+// Maior número de nós resolvido pelas versões de tamanho fixo (a tabela de 2^(n-1) * (n-1) custos fica na pilha)
+#define SMALL_TSP_MAX_NODES 12
+
+/**
+ * @brief Custo de um ciclo de tamanho fixo, com a soma das arestas desenrolada em tempo de compilação
+ *
+ * As arestas são somadas na mesma ordem de calculate_path_cost, então o resultado é idêntico.
+ *
+ * @tparam N O número de nós
+ * @param tour O ciclo
+ * @param distance A matriz de pesos plana, linha a linha
+ * @return O custo do ciclo, incluindo a aresta de volta ao primeiro nó
+ */
+template<size_t N, size_t... K>
+double small_tour_cost(const std::array<int, N>& tour, const std::array<double, N * N>& distance,
+                       std::index_sequence<K...>) {
+    return (0.0 + ... + distance[tour[K] * N + tour[(K + 1) % N]]);
+}
+
+template<size_t N>
+double small_tour_cost(const std::array<int, N>& tour, const std::array<double, N * N>& distance) {
+    return small_tour_cost<N>(tour, distance, std::make_index_sequence<N>());
+}
+
+/**
+ * @brief Resolve de forma exata uma instância com número de nós fixado em tempo de compilação
+ *
+ * É o mesmo Held-Karp de held_karp(), mas a matriz de pesos, a tabela da programação dinâmica e o ciclo
+ * são std::array na pilha, sem nenhuma alocação, e todos os laços têm limites constantes. Até três nós
+ * apenas os dois sentidos do ciclo são comparados.
+ *
+ * @tparam N O número de nós da instância (weights.size() == N)
+ * @param weights A matriz de pesos
+ * @return O caminho ótimo começando no nó 0 e seu custo, que também é o limitante inferior
+ */
+template<size_t N>
+TSPResult small_tsp_solve(const std::vector<std::vector<double>>& weights) {
+    static_assert(N >= 1 && N <= SMALL_TSP_MAX_NODES, "unsupported small instance size");
+
+    std::array<double, N * N> distance;
+    for (size_t i = 0; i < N; i++) {
+        for (size_t j = 0; j < N; j++) {
+            distance[i * N + j] = weights[i][j];
+        }
+    }
+
+    std::array<int, N> tour;
+    TSPResult result;
+
+    if constexpr (N <= 3) {
+        for (size_t node = 0; node < N; node++) {
+            tour[node] = node;
+        }
+        result.cost = N > 1 ? small_tour_cost<N>(tour, distance) : 0.0;
+
+        // Com três nós só existem os dois sentidos do ciclo
+        std::array<int, N> reversed = tour;
+        std::reverse(reversed.begin() + 1, reversed.end());
+        double backward = N > 1 ? small_tour_cost<N>(reversed, distance) : 0.0;
+        if (backward < result.cost) {
+            tour = reversed;
+            result.cost = backward;
+        }
+    } else {
+        // Nós 1..N-1 são representados pelos bits 0..M-1
+        constexpr size_t M = N - 1;
+        constexpr uint32_t SUBSETS = 1u << M;
+        const double infinity = std::numeric_limits<double>::infinity();
+
+        // Custos das arestas que chegam a cada nó, contíguos por nó de destino: incoming[j * M + i] = d(i+1, j+1)
+        std::array<double, M * M> incoming;
+        for (size_t j = 0; j < M; j++) {
+            for (size_t i = 0; i < M; i++) {
+                incoming[j * M + i] = distance[(i + 1) * N + j + 1];
+            }
+        }
+
+        std::array<double, SUBSETS * M> cost;
+        cost.fill(infinity);
+        for (size_t j = 0; j < M; j++) {
+            cost[((size_t)1 << j) * M + j] = distance[j + 1];
+        }
+
+        // Todo subconjunto anterior de mask é numericamente menor, então a ordem crescente basta; os laços
+        // percorrem apenas os bits ligados de cada conjunto
+        for (uint32_t mask = 1; mask < SUBSETS; mask++) {
+            if ((mask & (mask - 1)) == 0) {
+                continue;
+            }
+            for (uint32_t last_bits = mask; last_bits != 0; last_bits &= last_bits - 1) {
+                size_t j = __builtin_ctz(last_bits);
+                uint32_t previous = mask ^ (1u << j);
+                const double* previous_row = &cost[previous * M];
+                const double* into = &incoming[j * M];
+                double best = infinity;
+                for (uint32_t bits = previous; bits != 0; bits &= bits - 1) {
+                    size_t i = __builtin_ctz(bits);
+                    best = std::min(best, previous_row[i] + into[i]);
+                }
+                cost[mask * M + j] = best;
+            }
+        }
+
+        // Fecha o ciclo voltando ao nó 0
+        constexpr uint32_t FULL = SUBSETS - 1;
+        size_t last = 0;
+        double closing = infinity;
+        for (size_t j = 0; j < M; j++) {
+            double total = cost[FULL * M + j] + distance[(j + 1) * N];
+            if (total < closing) {
+                closing = total;
+                last = j;
+            }
+        }
+
+        // Reconstrói o ciclo de trás para frente escolhendo o melhor predecessor de cada estado
+        tour[0] = 0;
+        uint32_t mask = FULL;
+        size_t current = last;
+        for (size_t position = N - 1; position >= 1; position--) {
+            tour[position] = current + 1;
+            uint32_t previous = mask ^ (1u << current);
+            if (previous == 0) {
+                break;
+            }
+
+            size_t best_previous = M;
+            double best = infinity;
+            for (size_t i = 0; i < M; i++) {
+                if (previous & (1u << i)) {
+                    double candidate = cost[previous * M + i] + incoming[current * M + i];
+                    if (best_previous == M || candidate < best) {
+                        best = candidate;
+                        best_previous = i;
+                    }
+                }
+            }
+
+            mask = previous;
+            current = best_previous;
+        }
+
+        result.cost = small_tour_cost<N>(tour, distance);
+    }
+
+    result.path.assign(tour.begin(), tour.end());
+    // O custo é ótimo, então é também o limitante inferior
+    result.lower_bound = result.cost;
+
+    return result;
+}
+
+template<size_t... Sizes>
+TSPResult small_tsp(const std::vector<std::vector<double>>& weights, std::index_sequence<Sizes...>) {
+    typedef TSPResult (*Solver)(const std::vector<std::vector<double>>&);
+    static const Solver solvers[] = {&small_tsp_solve<Sizes + 1>...};
+    return solvers[weights.size() - 1](weights);
+}
+
+/**
+ * @brief Resolve de forma exata uma instância pequena, escolhendo a versão de tamanho fixo pelo número de nós
+ *
+ * O tamanho é despachado uma única vez por uma tabela de instanciações de small_tsp_solve, então o custo
+ * por chamada é o de resolver a instância, adequado para atender muitas instâncias pequenas em sequência.
+ *
+ * @param weights A matriz de pesos, com no máximo SMALL_TSP_MAX_NODES nós
+ * @return O caminho ótimo começando no nó 0 e seu custo, que também é o limitante inferior
+ */
+TSPResult small_tsp(const std::vector<std::vector<double>>& weights) {
+    if (weights.size() > SMALL_TSP_MAX_NODES) {
+        throw std::invalid_argument("small_tsp supports at most " + std::to_string(SMALL_TSP_MAX_NODES) + " nodes");
+    }
+    if (weights.empty()) {
+        return TSPResult();
+    }
+
+    return small_tsp(weights, std::make_index_sequence<SMALL_TSP_MAX_NODES>());
+}
+
+#endif // SMALL_TSP_H
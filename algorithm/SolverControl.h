@@ -0,0 +1,230 @@
+#ifndef SOLVER_CONTROL_H
+#define SOLVER_CONTROL_H
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <algorithm>
+
+#include "LowerBound.h"
+#include "LocalSearch.h"
+#include "TSPResult.h"
+
+// Intervalo mínimo, em milissegundos, entre duas chamadas do callback de melhora
+#define SOLVER_CALLBACK_INTERVAL_MS 10.0
+// Fração do tempo limite que pode ser gasta no cálculo do limitante inferior
+#define LOWER_BOUND_TIME_FRACTION 0.1
+
+/**
+ * @brief Estado da busca entregue ao callback de melhora
+ */
+struct SolverProgress {
+    const std::vector<int>& path; // Melhor caminho encontrado até o momento
+    double cost; // Custo do melhor caminho
+    double lower_bound; // Limitante inferior da instância (0 quando desconhecido)
+    double elapsed_ms; // Tempo decorrido desde o início da busca
+};
+
+/**
+ * @brief Critérios de parada e acompanhamento comuns a todos os solvers
+ */
+struct SolverControl {
+    double time_limit_ms = 0; // Tempo limite da busca (0 desativa o limite)
+    double target_cost = 0; // Custo que encerra a busca quando alcançado (0 desativa)
+    double gap_target = DEFAULT_GAP_TARGET; // Gap em relação ao limitante inferior que encerra a busca (negativo desativa)
+    bool compute_lower_bound = false; // Calcula o limitante inferior, e com ele o gap do resultado, mesmo sem gap desejado
+    long long stagnation_limit = 0; // Iterações consecutivas sem melhora que encerram a busca (0 desativa)
+    const std::atomic<bool>* cancel = nullptr; // Sinal de cancelamento cooperativo, verificado a cada iteração
+    std::function<void(const SolverProgress&)> on_improvement; // Chamado com o melhor caminho a cada melhora
+    double callback_interval_ms = SOLVER_CALLBACK_INTERVAL_MS; // Intervalo mínimo entre chamadas do callback
+};
+
+/**
+ * @brief Converte o tempo limite e o cancelamento de um SolverControl no orçamento de uma busca local
+ *
+ * Usado pelos solvers que aplicam uma única busca local a uma construção, para os quais a meta de custo e
+ * a estagnação não se aplicam.
+ *
+ * @param control Os critérios de parada
+ * @param elapsed_ms O tempo já gasto pelo solver, descontado do limite
+ * @return O orçamento com o tempo restante e o mesmo sinal de cancelamento
+ */
+LocalSearchBudget local_search_budget(const SolverControl& control, double elapsed_ms = 0.0) {
+    LocalSearchBudget budget;
+    if (control.time_limit_ms > 0) {
+        // Um orçamento 0 indicaria ausência de limite
+        budget.max_ms = std::max(control.time_limit_ms - elapsed_ms, 1e-3);
+    }
+    budget.cancel = control.cancel;
+    return budget;
+}
+
+/**
+ * @brief Indica se o tempo limite ou o cancelamento de um SolverControl encerram um solver sem iterações
+ * @param control Os critérios de parada
+ * @param elapsed_ms O tempo já gasto pelo solver
+ */
+bool control_expired(const SolverControl& control, double elapsed_ms) {
+    return (control.cancel != nullptr && control.cancel->load(std::memory_order_relaxed)) ||
+           (control.time_limit_ms > 0 && elapsed_ms >= control.time_limit_ms);
+}
+
+/**
+ * @brief Entrega ao callback de melhora o resultado de um solver que produz um único caminho
+ * @param control O controle com o callback
+ * @param result O resultado do solver (ignorado quando vazio)
+ * @param elapsed_ms O tempo gasto pelo solver
+ */
+void report_result(const SolverControl& control, const TSPResult& result, double elapsed_ms) {
+    if (control.on_improvement && !result.path.empty()) {
+        control.on_improvement(SolverProgress{result.path, result.cost, result.lower_bound, elapsed_ms});
+    }
+}
+
+/**
+ * @class SolverMonitor
+ * @brief Aplica um SolverControl durante a execução de um solver
+ *
+ * O solver informa cada melhora e cada iteração concluída, e consulta should_stop() para saber se deve
+ * encerrar. Melhoras informadas por várias threads são combinadas em um único melhor caminho global, e
+ * o callback é chamado no máximo uma vez por intervalo; a última melhora retida é entregue em finish().
+ */
+class SolverMonitor {
+    private:
+        const SolverControl& control;
+        std::chrono::steady_clock::time_point start_time;
+        std::chrono::steady_clock::time_point deadline;
+        double bound;
+
+        std::atomic<bool> stopped;
+        std::atomic<long long> stagnant_iterations;
+        std::mutex best_mutex;
+        std::vector<int> best_path;
+        double best_cost;
+        double last_callback_ms;
+        bool callback_pending;
+
+        void notify(double now_ms) {
+            last_callback_ms = now_ms;
+            callback_pending = false;
+            control.on_improvement(SolverProgress{best_path, best_cost, bound, now_ms});
+        }
+
+    public:
+        /**
+         * @brief Inicia o acompanhamento de uma busca
+         *
+         * O limitante inferior só é calculado quando é pedido em compute_lower_bound ou quando o critério
+         * do gap desejado precisa dele, e com tempo limite o cálculo usa no máximo
+         * LOWER_BOUND_TIME_FRACTION desse tempo.
+         *
+         * @param control Os critérios de parada e o callback
+         * @param weights A matriz de pesos da instância
+         */
+        SolverMonitor(const SolverControl& control, const std::vector<std::vector<double>>& weights)
+            : control(control), start_time(std::chrono::steady_clock::now()), bound(0.0), stopped(false),
+              stagnant_iterations(0), best_cost(std::numeric_limits<double>::infinity()),
+              last_callback_ms(-std::numeric_limits<double>::infinity()), callback_pending(false) {
+
+            deadline = std::chrono::steady_clock::time_point::max();
+            if (control.time_limit_ms > 0) {
+                deadline = start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double, std::milli>(control.time_limit_ms));
+            }
+
+            if (control.compute_lower_bound || control.gap_target >= 0) {
+                bound = instance_lower_bound(weights, SUBGRADIENT_ITERATIONS,
+                                             control.time_limit_ms * LOWER_BOUND_TIME_FRACTION);
+            }
+        }
+
+        SolverMonitor(const SolverMonitor&) = delete;
+        SolverMonitor& operator=(const SolverMonitor&) = delete;
+
+        /**
+         * @brief Retorna o limitante inferior da instância (0 quando não calculado)
+         */
+        double lower_bound() const {
+            return bound;
+        }
+
+        /**
+         * @brief Retorna o tempo decorrido desde o início da busca em milissegundos
+         */
+        double elapsed_ms() const {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+        }
+
+        /**
+         * @brief Informa um caminho encontrado pelo solver
+         * @param path O caminho
+         * @param cost O custo do caminho
+         * @return true se o caminho melhora o melhor caminho global
+         */
+        bool improve(const std::vector<int>& path, double cost) {
+            std::lock_guard<std::mutex> lock(best_mutex);
+            if (cost >= best_cost - IMPROVEMENT_EPSILON) {
+                return false;
+            }
+
+            best_path = path;
+            best_cost = cost;
+            stagnant_iterations = 0;
+
+            if ((control.target_cost > 0 && cost <= control.target_cost + IMPROVEMENT_EPSILON) ||
+                gap_target_reached(cost, bound, control.gap_target)) {
+                stopped = true;
+            }
+
+            if (control.on_improvement) {
+                double now_ms = elapsed_ms();
+                if (now_ms - last_callback_ms >= control.callback_interval_ms) {
+                    notify(now_ms);
+                } else {
+                    callback_pending = true;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Registra uma iteração concluída, usada pelo critério de estagnação
+         *
+         * Em solvers paralelos as iterações de todas as threads são somadas.
+         */
+        void iteration() {
+            stagnant_iterations++;
+        }
+
+        /**
+         * @brief Indica se a busca deve ser encerrada
+         * @return true se houve cancelamento, o tempo acabou, o alvo foi alcançado ou a busca estagnou
+         */
+        bool should_stop() {
+            if (stopped) {
+                return true;
+            }
+
+            if ((control.cancel != nullptr && control.cancel->load(std::memory_order_relaxed)) ||
+                (control.stagnation_limit > 0 && stagnant_iterations >= control.stagnation_limit) ||
+                std::chrono::steady_clock::now() >= deadline) {
+                stopped = true;
+            }
+            return stopped;
+        }
+
+        /**
+         * @brief Entrega ao callback a última melhora retida pelo intervalo mínimo
+         */
+        void finish() {
+            std::lock_guard<std::mutex> lock(best_mutex);
+            if (callback_pending && control.on_improvement) {
+                notify(elapsed_ms());
+            }
+        }
+};
+
+#endif // SOLVER_CONTROL_H
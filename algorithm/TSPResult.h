@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <iostream>
+#include <limits>
+#include <algorithm>
 #include "../graph/IGraph.h"
 
 /**
@@ -12,8 +14,20 @@ struct TSPResult
 {
     std::vector<int> path; // Caminho percorrido em índices
     double cost; // Custo total obtido
+    double lower_bound; // Limitante inferior do custo ótimo (0 quando desconhecido)
 
-    TSPResult() : cost(0.0) {}
+    TSPResult() : cost(0.0), lower_bound(0.0) {}
+
+    /**
+     * @brief Calcula o gap de otimalidade relativo ao limitante inferior
+     * @return (cost - lower_bound) / lower_bound, ou infinito quando o limitante é desconhecido
+     */
+    double gap() const {
+        if (lower_bound <= 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return std::max(0.0, (cost - lower_bound) / lower_bound);
+    }
 };
 
 /**
@@ -28,6 +42,9 @@ void print_tsp_result(const IGraph<Node>& graph, const TSPResult& result) {
         std::cout << graph.get_node(node) << " ";
     }
     std::cout << "\nTotal Cost: " << result.cost << std::endl;
+    if (result.lower_bound > 0) {
+        std::cout << "Lower Bound: " << result.lower_bound << "\nGap: " << result.gap() * 100 << "%" << std::endl;
+    }
 }
 
 
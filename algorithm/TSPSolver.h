@@ -0,0 +1,62 @@
+#ifndef TSP_SOLVER_H
+#define TSP_SOLVER_H
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include "../graph/IGraph.h"
+#include "TSPResult.h"
+#include "HeldKarp.h"
+#include "SmallTSP.h"
+#include "IteratedLocalSearch.h"
+#include "SolverControl.h"
+
+// Maior instância resolvida de forma exata pelo despachante
+#define EXACT_SOLVER_THRESHOLD 16
+
+/**
+ * @brief Resolve o problema do caixeiro viajante escolhendo o algoritmo pelo tamanho da instância
+ *
+ * Instâncias pequenas são resolvidas de forma exata pelo Held-Karp, cujo custo cresce com 2^n; acima do
+ * limite a busca local iterada é usada como heurística. Até SMALL_TSP_MAX_NODES nós o Held-Karp usado é a
+ * versão de tamanho fixo, sem alocações. O controle é repassado ao Held-Karp e à busca local iterada; se o
+ * Held-Karp for interrompido, a busca local iterada recebe o tempo restante.
+ *
+ * @tparam Node O tipo de dado dos nós no grafo
+ * @param graph O grafo para aplicação do algoritmo
+ * @param weights A matriz de pesos
+ * @param control Os critérios de parada e o callback de melhora
+ * @param exact_threshold O maior número de nós resolvido de forma exata
+ * @return O caminho encontrado e seu custo
+ */
+template<typename Node>
+TSPResult solve_tsp(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weights,
+    const SolverControl& control = SolverControl(), size_t exact_threshold = EXACT_SOLVER_THRESHOLD) {
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    if (graph.get_order() <= exact_threshold && graph.get_order() <= HELD_KARP_MAX_NODES) {
+        if (weights.size() <= SMALL_TSP_MAX_NODES) {
+            TSPResult result = small_tsp(weights);
+            report_result(control, result, 0.0);
+            return result;
+        }
+
+        TSPResult result = held_karp(weights, 0, control);
+        if (!result.path.empty()) {
+            return result;
+        }
+    }
+
+    // O tempo já gasto pelo Held-Karp interrompido é descontado do limite
+    SolverControl remaining = control;
+    if (control.time_limit_ms > 0) {
+        double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+        remaining.time_limit_ms = std::max(control.time_limit_ms - elapsed_ms, 1e-3);
+    }
+
+    return iterated_local_search(graph, weights, graph.get_node(0), IteratedLocalSearchParameters(), remaining);
+}
+
+#endif
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
+#include "../algorithm/BranchAndBound.h"
+#include "../algorithm/TSPResult.h"
+#include "../utils/TSPUtils.h"
+
+int main() {
+
+    std::vector<std::string> files = {
+        "data/problem_1.csv",
+        "data/problem_2.csv",
+        "data/problem_3.csv",
+        "data/problem_4.csv",
+        "data/problem_5.csv",
+        "data/problem_6.csv",
+        "data/problem_7.csv",
+        "data/problem_8.csv",
+        "data/problem_9.csv",
+        "data/problem_10.csv",
+        "data/problem_11.csv",
+        "data/problem_12.csv",
+        "data/small_example.csv"
+    };
+
+    std::ofstream output("result/branchbound_results.txt");
+    if(!output.is_open()) {
+        std::cerr << "Could not open output file for writing results.\n";
+        return 1;
+    }
+
+    for(const auto& filename : files) {
+        DirectedAdjacencyListGraph<int> graph;
+        std::vector<std::vector<double>> weights;
+
+        try {
+            populate_graph_from_csv<int>(filename, graph, weights);
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            continue;
+        }
+
+        output << "\nResults for file: " << filename << "\n";
+
+        // Começa a marcar o tempo de execução
+        auto start_time = std::chrono::high_resolution_clock::now();
+
+        // Execução do branch-and-bound
+        SolverControl control;
+        control.time_limit_ms = BRANCH_AND_BOUND_TIME_LIMIT_MS;
+        auto bnb_result = branch_and_bound(graph, weights, BranchAndBoundParameters(), control);
+
+        // Termina de marcar o tempo de execução
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<double, std::milli>(end_time - start_time);
+
+        output << "[Branch and Bound]\n";
+        output << "Cost: " << bnb_result.cost << "\n";
+        output << "Lower Bound: " << bnb_result.lower_bound << "\n";
+        output << "Optimal: " << (bnb_result.optimal ? "yes" : "no") << "\n";
+        output << "Explored Nodes: " << bnb_result.explored_nodes << "\n";
+        output << "Path: ";
+        for (const auto& node : bnb_result.path) {
+            output << graph.get_node(node) << " ";
+        }
+        output << "\n";
+        output << "Time: " << duration.count() << "\n";
+
+    }
+
+    output.close();
+    std::cout << "Branch and bound tests completed. Results written to 'result/branchbound_results.txt'.\n";
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
+#include "../algorithm/IslandGeneticSearch.h"
+#include "../algorithm/TSPResult.h"
+#include "../utils/TSPUtils.h"
+
+int main() {
+
+    std::vector<std::string> files = {
+        "data/problem_1.csv",
+        "data/problem_2.csv",
+        "data/problem_3.csv",
+        "data/problem_4.csv",
+        "data/problem_5.csv",
+        "data/problem_6.csv",
+        "data/problem_7.csv",
+        "data/problem_8.csv",
+        "data/problem_9.csv",
+        "data/problem_10.csv",
+        "data/problem_11.csv",
+        "data/problem_12.csv",
+        "data/small_example.csv"
+    };
+
+    std::ofstream output("result/island_results.txt");
+    if(!output.is_open()) {
+        std::cerr << "Could not open output file for writing results.\n";
+        return 1;
+    }
+
+    for(const auto& filename : files) {
+        DirectedAdjacencyListGraph<int> graph;
+        std::vector<std::vector<double>> weights;
+
+        try {
+            populate_graph_from_csv<int>(filename, graph, weights);
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            continue;
+        }
+
+        output << "\nResults for file: " << filename << "\n";
+
+        SolverControl control;
+        control.compute_lower_bound = true;
+
+        // Começa a marcar o tempo de execução
+        auto start_time = std::chrono::high_resolution_clock::now();
+
+        // Execução do algoritmo genético em ilhas
+        auto island_result = island_genetic_search(graph, weights, IslandParameters(), control);
+
+        // Termina de marcar o tempo de execução
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<double, std::milli>(end_time - start_time);
+
+        output << "[Island Genetic Algorithm]\n";
+        output << "Cost: " << island_result.cost << "\n";
+        output << "Gap: " << island_result.gap() * 100 << "%\n";
+        output << "Path: ";
+        for (const auto& node : island_result.path) {
+            output << graph.get_node(node) << " ";
+        }
+        output << "\n";
+        output << "Time: " << duration.count() << "\n";
+
+    }
+
+    output.close();
+    std::cout << "Island Genetic Algorithm tests completed. Results written to 'result/island_results.txt'.\n";
+
+    return 0;
+}
@@ -2,7 +2,12 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <cstdint>
+#include <cmath>
+#include <stdexcept>
 
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
 #include "../algorithm/LocalSearch.h"
 #include "../algorithm/TSPResult.h"
 #include "../utils/TSPUtils.h"
@@ -73,8 +78,44 @@ int main() {
     std::cout << "Optimized Path: ";
     print_path(result.solution);
     std::cout << "\nFinal Cost: " << result.cost << "\n";
-    
 
+    std::cout << "\nInitiating Fixed-Point Local Search Test...\n";
+
+    // A mesma instância carregada em double e em ponto fixo (escala 100, duas casas decimais)
+    const std::string filename = "data/problem_1.csv";
+    const double scale = 100.0;
+    DirectedAdjacencyListGraph<int> real_graph, integer_graph;
+    std::vector<std::vector<double>> real_weights;
+    std::vector<std::vector<int32_t>> integer_weights;
+    try {
+        populate_graph_from_csv<int>(filename, real_graph, real_weights);
+        populate_graph_from_csv<int>(filename, integer_graph, integer_weights, scale);
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::vector<int> initial_path(real_weights.size());
+    for (size_t i = 0; i < initial_path.size(); i++) {
+        initial_path[i] = i;
+    }
+
+    LocalSearchResult real_result = local_search(real_weights, initial_path, LocalSearchMethod::VND,
+                                                 ImprovementType::FIRST_IMPROVEMENT);
+    IntegerLocalSearchResult integer_result = local_search(integer_weights, initial_path, LocalSearchMethod::VND,
+                                                           ImprovementType::FIRST_IMPROVEMENT);
+    int64_t expected_cost = std::llround(real_result.cost * scale);
+
+    std::cout << "\nVND + FIRST IMPROVEMENT (" << filename << ", scale " << scale << ")\n";
+    std::cout << "Double Cost: " << real_result.cost << "\n";
+    std::cout << "Fixed-Point Cost: " << integer_result.cost << "\n";
+    std::cout << "Expected Cost: " << expected_cost << "\n";
+
+    if (integer_result.cost != expected_cost || integer_result.solution != real_result.solution) {
+        std::cout << "FAILED: fixed-point local search diverged from the double version\n";
+        return 1;
+    }
+    std::cout << "OK\n";
 
     return 0;
 }
\ No newline at end of file
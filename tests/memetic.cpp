@@ -53,11 +53,14 @@ int main()
 
         output << "\nResults for file: " << filename << "\n";
 
+        SolverControl control;
+        control.compute_lower_bound = true;
+
         // Começa a marcar o tempo de execução
         auto start_time = std::chrono::high_resolution_clock::now();
 
         // Execução do algoritmo memetico
-        auto memeticResult = memetic_search(graph, weights);
+        auto memeticResult = memetic_search(graph, weights, GeneticParameters(), control);
 
         // Termina de marcar o tempo de execução
         auto end_time = std::chrono::high_resolution_clock::now();
@@ -65,6 +68,7 @@ int main()
 
         output << "[Memetic Algorithm]\n";
         output << "Cost: " << memeticResult.cost << "\n";
+        output << "Gap: " << memeticResult.gap() * 100 << "%\n";
         output << "Path: ";
         for (const auto& node : memeticResult.path) {
             output << graph.get_node(node) << " ";
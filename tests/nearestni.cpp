@@ -41,7 +41,8 @@ int main() {
     std::vector<LocalSearchMethod> methods = {
         LocalSearchMethod::SWAP,
         LocalSearchMethod::SHIFT,
-        LocalSearchMethod::INVERT
+        LocalSearchMethod::INVERT,
+        LocalSearchMethod::VND
     };
 
     std::vector<ImprovementType> improvements = {
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
+#include "../algorithm/SmallTSP.h"
+#include "../algorithm/HeldKarp.h"
+#include "../algorithm/TSPResult.h"
+#include "../utils/TSPUtils.h"
+
+int main() {
+
+    // Apenas as instâncias com até SMALL_TSP_MAX_NODES nós
+    std::vector<std::string> files = {
+        "data/problem_7.csv",
+        "data/problem_8.csv",
+        "data/problem_9.csv",
+        "data/problem_10.csv",
+        "data/problem_11.csv",
+        "data/problem_12.csv",
+        "data/small_example.csv"
+    };
+
+    // Número de vezes que cada instância é resolvida para medir o tempo de uma chamada
+    const int repetitions = 1000;
+
+    std::ofstream output("result/small_results.txt");
+    if(!output.is_open()) {
+        std::cerr << "Could not open output file for writing results.\n";
+        return 1;
+    }
+
+    for(const auto& filename : files) {
+        DirectedAdjacencyListGraph<int> graph;
+        std::vector<std::vector<double>> weights;
+
+        try {
+            populate_graph_from_csv<int>(filename, graph, weights);
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            continue;
+        }
+
+        output << "\nResults for file: " << filename << "\n";
+
+        // Começa a marcar o tempo de execução
+        auto start_time = std::chrono::high_resolution_clock::now();
+
+        TSPResult small_result;
+        for(int repetition = 0; repetition < repetitions; repetition++) {
+            small_result = small_tsp(weights);
+        }
+
+        // Termina de marcar o tempo de execução
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<double, std::milli>(end_time - start_time);
+
+        // O Held-Karp dinâmico serve de referência para o custo ótimo
+        TSPResult reference = held_karp(weights, 1);
+
+        output << "[Small Instance Solver]\n";
+        output << "Cost: " << small_result.cost << "\n";
+        output << "Held-Karp Cost: " << reference.cost << "\n";
+        output << "Path: ";
+        for (const auto& node : small_result.path) {
+            output << graph.get_node(node) << " ";
+        }
+        output << "\n";
+        output << "Time: " << duration.count() / repetitions << "\n";
+    }
+
+    output.close();
+    std::cout << "Small instance tests completed. Results written to 'result/small_results.txt'.\n";
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
+#include "../algorithm/GeneticSearch.h"
+#include "../algorithm/ParameterTuner.h"
+#include "../algorithm/SolverControl.h"
+#include "../utils/TSPUtils.h"
+
+int main() {
+
+    std::vector<std::string> files = {
+        "data/problem_1.csv",
+        "data/problem_2.csv",
+        "data/problem_3.csv",
+        "data/problem_4.csv",
+        "data/problem_5.csv",
+        "data/problem_6.csv",
+        "data/problem_7.csv",
+        "data/problem_8.csv",
+        "data/problem_9.csv",
+        "data/problem_10.csv",
+        "data/problem_11.csv",
+        "data/problem_12.csv",
+        "data/small_example.csv"
+    };
+
+    std::ofstream output("result/tune_results.txt");
+    if(!output.is_open()) {
+        std::cerr << "Could not open output file for writing results.\n";
+        return 1;
+    }
+
+    std::vector<DirectedAdjacencyListGraph<int>> graphs;
+    std::vector<std::vector<std::vector<double>>> instances;
+
+    for(const auto& filename : files) {
+        DirectedAdjacencyListGraph<int> graph;
+        std::vector<std::vector<double>> weights;
+
+        try {
+            populate_graph_from_csv<int>(filename, graph, weights);
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            continue;
+        }
+
+        graphs.push_back(graph);
+        instances.push_back(weights);
+    }
+
+    // Grade de configurações: população x mutação x seleções aleatórias por ciclo
+    std::vector<GeneticParameters> configs;
+    for (size_t population_size : {100, 250, 500}) {
+        for (double mutation_percent : {0.1, 0.5, 0.9}) {
+            for (int random_selections : {0, 1, 2}) {
+                GeneticParameters params;
+                params.population_size = population_size;
+                params.mutation_percent = mutation_percent;
+                params.random_selections = random_selections;
+                configs.push_back(params);
+            }
+        }
+    }
+
+    // Cada execução é limitada apenas pelo tempo da rodada
+    auto evaluate = [&](const GeneticParameters& params, size_t instance, double run_time_ms) {
+        SolverControl control;
+        control.time_limit_ms = run_time_ms;
+        std::vector<int> path = genetic_search(graphs[instance], instances[instance], params, control);
+        return calculate_path_cost(instances[instance], path);
+    };
+
+    // Começa a marcar o tempo de execução
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    auto ranking = successive_halving(configs, instances.size(), evaluate);
+
+    // Termina de marcar o tempo de execução
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration<double, std::milli>(end_time - start_time);
+
+    output << "[Genetic Parameter Racing]\n";
+    for (const auto& candidate : ranking) {
+        output << "Population: " << candidate.config.population_size
+               << " Mutation: " << candidate.config.mutation_percent
+               << " Random Selections: " << candidate.config.random_selections << "/" << candidate.config.selection_cycle
+               << " Rounds: " << candidate.rounds
+               << " Score: " << std::fixed << std::setprecision(4) << candidate.score
+               << std::defaultfloat << std::setprecision(6) << "\n";
+    }
+    output << "Time: " << duration.count() << "\n";
+
+    output.close();
+    std::cout << "Parameter tuning completed. Results written to 'result/tune_results.txt'.\n";
+
+    return 0;
+}
@@ -9,6 +9,8 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <cmath>
+#include <cstdint>
 
 #include "Dfs.h"
 #include "../graph/UndirectedAdjacencyListGraph.h"
@@ -103,6 +105,44 @@ void populate_graph_from_csv(const std::string& filename,
     file.close();
 }
 
+/**
+ * @brief Popula um grafo a partir de um arquivo CSV com pesos inteiros em ponto fixo
+ *
+ * Cada peso é multiplicado pela escala e arredondado para o inteiro mais próximo, de forma que a matriz
+ * ocupa metade da memória da versão double e as somas de custos (em int64_t) são exatas. Arestas ausentes
+ * recebem std::numeric_limits<int32_t>::max(). Os custos obtidos com esta matriz estão na mesma escala.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O nome do arquivo CSV.
+ * @param graph O grafo a ser populado.
+ * @param weights A matriz de pesos escalados
+ * @param scale O fator de escala dos pesos (por exemplo 100 para duas casas decimais)
+ */
+template<typename Node>
+void populate_graph_from_csv(const std::string& filename,
+    IGraph<Node>& graph, std::vector<std::vector<int32_t>>& weights, double scale) {
+    std::vector<std::vector<double>> real_weights;
+    populate_graph_from_csv(filename, graph, real_weights);
+
+    const int32_t missing = std::numeric_limits<int32_t>::max();
+    weights.assign(real_weights.size(), std::vector<int32_t>(real_weights.size(), missing));
+
+    for (size_t i = 0; i < real_weights.size(); ++i) {
+        for (size_t j = 0; j < real_weights.size(); ++j) {
+            if (real_weights[i][j] == std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+
+            // O maior inteiro fica reservado para as arestas ausentes
+            double scaled = std::round(real_weights[i][j] * scale);
+            if (!(std::fabs(scaled) < (double)missing)) {
+                throw std::runtime_error("Weight out of range for scale " + std::to_string(scale) + " in file: " + filename);
+            }
+            weights[i][j] = (int32_t)scaled;
+        }
+    }
+}
+
 /**
  * @brief Exibe a matriz de pesos de forma formatada
  *
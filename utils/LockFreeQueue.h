@@ -0,0 +1,189 @@
+#ifndef LOCK_FREE_QUEUE_H
+#define LOCK_FREE_QUEUE_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class SpscQueue
+ * @brief Fila circular limitada e sem travas para um único produtor e um único consumidor.
+ * @tparam T O tipo dos elementos armazenados.
+ *
+ * O produtor escreve apenas no índice de escrita e o consumidor apenas no índice de leitura, de forma
+ * que a sincronização se resume a operações atômicas de aquisição/liberação. As operações nunca
+ * bloqueiam: try_push falha quando a fila está cheia e try_pop falha quando está vazia.
+ */
+template<typename T>
+class SpscQueue {
+    private:
+        /*Posições da fila; uma posição fica sempre livre para distinguir fila cheia de vazia*/
+        std::vector<T> buffer;
+        /*Índice da próxima leitura, alterado apenas pelo consumidor*/
+        alignas(64) std::atomic<size_t> head;
+        /*Índice da próxima escrita, alterado apenas pelo produtor*/
+        alignas(64) std::atomic<size_t> tail;
+
+    public:
+        /**
+         * @brief Cria uma fila com a capacidade informada.
+         * @param capacity O número máximo de elementos armazenados simultaneamente.
+         */
+        explicit SpscQueue(size_t capacity) : buffer(capacity + 1), head(0), tail(0) {}
+
+        /**
+         * @brief Insere um elemento na fila (apenas pelo produtor).
+         * @param value O elemento a ser inserido.
+         * @return true se o elemento foi inserido, false se a fila estava cheia.
+         */
+        bool try_push(T value) {
+            size_t current_tail = tail.load(std::memory_order_relaxed);
+            size_t next_tail = (current_tail + 1) % buffer.size();
+
+            /*Fila cheia: o consumidor ainda não liberou a próxima posição*/
+            if (next_tail == head.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            buffer[current_tail] = std::move(value);
+            tail.store(next_tail, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Remove o elemento mais antigo da fila (apenas pelo consumidor).
+         * @param value Recebe o elemento removido.
+         * @return true se um elemento foi removido, false se a fila estava vazia.
+         */
+        bool try_pop(T& value) {
+            size_t current_head = head.load(std::memory_order_relaxed);
+
+            /*Fila vazia: o produtor ainda não publicou nenhum elemento novo*/
+            if (current_head == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            value = std::move(buffer[current_head]);
+            head.store((current_head + 1) % buffer.size(), std::memory_order_release);
+            return true;
+        }
+};
+
+/**
+ * @class MpmcQueue
+ * @brief Fila circular limitada e sem travas para vários produtores e vários consumidores (Vyukov).
+ * @tparam T O tipo dos elementos armazenados.
+ *
+ * Cada posição guarda um número de sequência que indica de qual volta da fila ela está à espera: um
+ * produtor só escreve quando a sequência é igual à sua posição de escrita, e um consumidor só lê quando
+ * ela é igual à sua posição de leitura mais um. Produtores e consumidores disputam apenas o índice do seu
+ * lado, com um compare-and-swap por operação. As operações nunca bloqueiam.
+ */
+template<typename T>
+class MpmcQueue {
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T value;
+        };
+
+        /*Posições da fila; a capacidade é arredondada para uma potência de 2*/
+        std::unique_ptr<Cell[]> buffer;
+        size_t mask;
+        /*Próxima posição de escrita, disputada pelos produtores*/
+        alignas(64) std::atomic<size_t> enqueue_position;
+        /*Próxima posição de leitura, disputada pelos consumidores*/
+        alignas(64) std::atomic<size_t> dequeue_position;
+
+    public:
+        /**
+         * @brief Cria uma fila com pelo menos a capacidade informada.
+         * @param capacity O número mínimo de elementos armazenados simultaneamente.
+         */
+        explicit MpmcQueue(size_t capacity) : enqueue_position(0), dequeue_position(0) {
+            size_t size = 2;
+            while (size < capacity) {
+                size *= 2;
+            }
+
+            buffer.reset(new Cell[size]);
+            mask = size - 1;
+            for (size_t i = 0; i < size; i++) {
+                buffer[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        /**
+         * @brief Insere um elemento na fila.
+         *
+         * O elemento só é copiado ou movido quando a inserção tem sucesso, então um valor passado com
+         * std::move continua intacto se a fila estiver cheia e pode ser reenviado.
+         *
+         * @param value O elemento a ser inserido.
+         * @return true se o elemento foi inserido, false se a fila estava cheia.
+         */
+        template<typename U>
+        bool try_push(U&& value) {
+            size_t position = enqueue_position.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true) {
+                cell = &buffer[position & mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+
+                if (difference == 0) {
+                    if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    /*Fila cheia: a posição ainda guarda um elemento da volta anterior*/
+                    return false;
+                } else {
+                    position = enqueue_position.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->value = std::forward<U>(value);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Remove o elemento mais antigo da fila.
+         * @param value Recebe o elemento removido.
+         * @return true se um elemento foi removido, false se a fila estava vazia.
+         */
+        bool try_pop(T& value) {
+            size_t position = dequeue_position.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true) {
+                cell = &buffer[position & mask];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)(position + 1);
+
+                if (difference == 0) {
+                    if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    /*Fila vazia: nenhum produtor publicou a posição ainda*/
+                    return false;
+                } else {
+                    position = dequeue_position.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = std::move(cell->value);
+            cell->sequence.store(position + mask + 1, std::memory_order_release);
+            return true;
+        }
+};
+
+#endif // LOCK_FREE_QUEUE_H
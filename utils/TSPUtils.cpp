@@ -3,9 +3,23 @@
 #include <limits>
 #include <cstddef>
 #include <string>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
 
-double calculate_path_cost(const std::vector<std::vector<double>>& weights, const std::vector<int>& path) {
-    double total_cost = 0.0;
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TSP_UTILS_X86 1
+#endif
+
+/**
+ * @brief Soma as arestas do ciclo acumulando no tipo do custo
+ * @tparam Weight O tipo dos pesos
+ */
+template<typename Weight>
+typename WeightTraits<Weight>::Cost path_cost(const std::vector<std::vector<Weight>>& weights,
+                                              const std::vector<int>& path) {
+    typename WeightTraits<Weight>::Cost total_cost = 0;
     size_t path_size = path.size();
 
     // Se o caminho tiver menos de 2 nós, o custo é zero
@@ -26,11 +40,254 @@ double calculate_path_cost(const std::vector<std::vector<double>>& weights, cons
     return total_cost;
 }
 
+double calculate_path_cost(const std::vector<std::vector<double>>& weights, const std::vector<int>& path) {
+    return path_cost(weights, path);
+}
+
+int64_t calculate_path_cost(const std::vector<std::vector<int32_t>>& weights, const std::vector<int>& path) {
+    return path_cost(weights, path);
+}
+
+FlatWeights flatten_weights(const std::vector<std::vector<double>>& weights) {
+    FlatWeights flat;
+    flat.order = weights.size();
+    flat.values.resize(flat.order * flat.order);
+
+    for (size_t i = 0; i < flat.order; ++i) {
+        std::copy(weights[i].begin(), weights[i].end(), flat.values.begin() + i * flat.order);
+    }
+
+    return flat;
+}
+
+/**
+ * @brief Soma escalar das arestas com quatro acumuladores, quebrando a cadeia de dependência das somas
+ */
+template<typename Index>
+static double path_cost_scalar(const double* values, size_t order, const Index* path, size_t path_size) {
+    double partial[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t k = 0;
+
+    for (; k + 4 < path_size; k += 4) {
+        partial[0] += values[path[k] * order + path[k + 1]];
+        partial[1] += values[path[k + 1] * order + path[k + 2]];
+        partial[2] += values[path[k + 2] * order + path[k + 3]];
+        partial[3] += values[path[k + 3] * order + path[k + 4]];
+    }
+
+    double total_cost = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+    for (; k + 1 < path_size; ++k) {
+        total_cost += values[path[k] * order + path[k + 1]];
+    }
+
+    return total_cost + values[path[path_size - 1] * order + path[0]];
+}
+
+#ifdef TSP_UTILS_X86
+/**
+ * @brief Soma das arestas com gathers AVX2, oito arestas por iteração em dois acumuladores
+ *
+ * Os índices from * order + to são calculados em 32 bits, então exige order * order < 2^31.
+ */
+__attribute__((target("avx2")))
+static double path_cost_avx2(const double* values, size_t order, const int* path, size_t path_size) {
+    __m256d first = _mm256_setzero_pd();
+    __m256d second = _mm256_setzero_pd();
+    // Máscara com todas as pistas ativas; o gather mascarado parte de um vetor zerado
+    const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    __m128i row = _mm_set1_epi32((int)order);
+    size_t k = 0;
+
+    // As arestas k..k+7 leem os nós k..k+8
+    for (; k + 8 < path_size; k += 8) {
+        __m128i from = _mm_loadu_si128((const __m128i*)(path + k));
+        __m128i to = _mm_loadu_si128((const __m128i*)(path + k + 1));
+        first = _mm256_add_pd(first, _mm256_mask_i32gather_pd(_mm256_setzero_pd(), values,
+                                                               _mm_add_epi32(_mm_mullo_epi32(from, row), to),
+                                                               all_lanes, 8));
+
+        from = _mm_loadu_si128((const __m128i*)(path + k + 4));
+        to = _mm_loadu_si128((const __m128i*)(path + k + 5));
+        second = _mm256_add_pd(second, _mm256_mask_i32gather_pd(_mm256_setzero_pd(), values,
+                                                                 _mm_add_epi32(_mm_mullo_epi32(from, row), to),
+                                                                 all_lanes, 8));
+    }
+
+    __m256d sum = _mm256_add_pd(first, second);
+    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    double total_cost = _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+
+    for (; k + 1 < path_size; ++k) {
+        total_cost += values[path[k] * order + path[k + 1]];
+    }
+
+    return total_cost + values[path[path_size - 1] * order + path[0]];
+}
+
+/**
+ * @brief Nós da posição k de quatro caminhos, um por pista
+ */
+template<typename Index>
+__attribute__((target("avx2")))
+static inline __m128i path_nodes_avx2(const Index* const* paths, size_t k) {
+    return _mm_setr_epi32(paths[0][k], paths[1][k], paths[2][k], paths[3][k]);
+}
+
+/**
+ * @brief Pesos das arestas (from, to) de quatro pistas, lidos por um único gather
+ */
+__attribute__((target("avx2")))
+static inline __m256d edge_weights_avx2(const double* values, __m128i row, __m128i from, __m128i to) {
+    const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), values, _mm_add_epi32(_mm_mullo_epi32(from, row), to),
+                                    all_lanes, 8);
+}
+
+/**
+ * @brief Custo de quatro caminhos de uma vez, um por pista do vetor
+ *
+ * A cada passo um único gather lê a aresta k dos quatro caminhos, então as quatro somas avançam em paralelo
+ * e os acessos à matriz de caminhos diferentes ficam em voo ao mesmo tempo. Os nós são lidos um a um, o que
+ * aceita caminhos guardados em qualquer tipo inteiro. Exige order * order < 2^31.
+ */
+template<typename Index>
+__attribute__((target("avx2")))
+static void path_costs_avx2(const double* values, size_t order, const Index* const* paths, size_t path_size,
+                            double* costs) {
+    __m128i row = _mm_set1_epi32((int)order);
+    __m256d first = _mm256_setzero_pd();
+    __m256d second = _mm256_setzero_pd();
+
+    // Duas arestas por iteração, em acumuladores separados
+    __m128i from = path_nodes_avx2(paths, 0);
+    size_t k = 0;
+    for (; k + 2 < path_size; k += 2) {
+        __m128i middle = path_nodes_avx2(paths, k + 1);
+        __m128i to = path_nodes_avx2(paths, k + 2);
+        first = _mm256_add_pd(first, edge_weights_avx2(values, row, from, middle));
+        second = _mm256_add_pd(second, edge_weights_avx2(values, row, middle, to));
+        from = to;
+    }
+    for (; k + 1 < path_size; ++k) {
+        __m128i to = path_nodes_avx2(paths, k + 1);
+        first = _mm256_add_pd(first, edge_weights_avx2(values, row, from, to));
+        from = to;
+    }
+
+    // Aresta de volta ao primeiro nó
+    first = _mm256_add_pd(first, edge_weights_avx2(values, row, from, path_nodes_avx2(paths, 0)));
+    _mm256_storeu_pd(costs, _mm256_add_pd(first, second));
+}
+#endif
+
+double calculate_path_cost(const FlatWeights& weights, const int* path, size_t path_size) {
+    // Se o caminho tiver menos de 2 nós, o custo é zero
+    if (path_size < 2) {
+        return 0.0;
+    }
+
+#ifdef TSP_UTILS_X86
+    // Caminhos curtos não completam duas iterações vetoriais e ficam com a soma escalar
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2 && path_size >= 16 && weights.order * weights.order <= (size_t)INT32_MAX) {
+        return path_cost_avx2(weights.values.data(), weights.order, path, path_size);
+    }
+#endif
+
+    return path_cost_scalar(weights.values.data(), weights.order, path, path_size);
+}
+
+template<typename Index>
+void calculate_path_costs(const FlatWeights& weights, const std::vector<const Index*>& paths, size_t path_size,
+                          std::vector<double>& costs) {
+    costs.assign(paths.size(), 0.0);
+    if (path_size < 2) {
+        return;
+    }
+
+    size_t t = 0;
+#ifdef TSP_UTILS_X86
+    // Grupos de quatro caminhos ocupam as pistas do vetor; os que sobram são somados um a um
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2 && weights.order * weights.order <= (size_t)INT32_MAX) {
+        for (; t + 4 <= paths.size(); t += 4) {
+            path_costs_avx2(weights.values.data(), weights.order, paths.data() + t, path_size, costs.data() + t);
+        }
+    }
+#endif
+
+    for (; t < paths.size(); ++t) {
+        if constexpr (std::is_same<Index, int>::value) {
+            costs[t] = calculate_path_cost(weights, paths[t], path_size);
+        } else {
+            costs[t] = path_cost_scalar(weights.values.data(), weights.order, paths[t], path_size);
+        }
+    }
+}
+
+// Caminhos em std::vector<int> e nas arenas da população (16 e 32 bits)
+template void calculate_path_costs<int>(const FlatWeights&, const std::vector<const int*>&, size_t,
+                                        std::vector<double>&);
+template void calculate_path_costs<uint16_t>(const FlatWeights&, const std::vector<const uint16_t*>&, size_t,
+                                             std::vector<double>&);
+template void calculate_path_costs<uint32_t>(const FlatWeights&, const std::vector<const uint32_t*>&, size_t,
+                                             std::vector<double>&);
+
+template<typename Weight>
+bool symmetric_weights(const std::vector<std::vector<Weight>>& weights) {
+    size_t order = weights.size();
+
+    for (size_t i = 0; i < order; ++i) {
+        for (size_t j = i + 1; j < order; ++j) {
+            if (weights[i][j] != weights[j][i]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool is_symmetric(const std::vector<std::vector<double>>& weights) {
+    return symmetric_weights(weights);
+}
+
+bool is_symmetric(const std::vector<std::vector<int32_t>>& weights) {
+    return symmetric_weights(weights);
+}
+
+std::vector<std::vector<int>> build_candidate_lists(const std::vector<std::vector<double>>& weights, size_t k) {
+    size_t order = weights.size();
+    std::vector<std::vector<int>> candidates(order);
+    std::vector<int> neighbors;
+
+    for (size_t i = 0; i < order; ++i) {
+        // Todos os outros nós alcançáveis a partir de i
+        neighbors.clear();
+        for (size_t j = 0; j < order; ++j) {
+            if (j != i && weights[i][j] != std::numeric_limits<double>::infinity()) {
+                neighbors.push_back(j);
+            }
+        }
+
+        size_t count = std::min(k, neighbors.size());
+
+        // Seleciona apenas os k mais próximos, sem ordenar a lista inteira
+        std::partial_sort(neighbors.begin(), neighbors.begin() + count, neighbors.end(),
+            [&](int a, int b) { return weights[i][a] < weights[i][b]; });
+
+        candidates[i].assign(neighbors.begin(), neighbors.begin() + count);
+    }
+
+    return candidates;
+}
+
 std::string method_to_string(LocalSearchMethod method) {
     switch (method) {
         case LocalSearchMethod::SWAP:   return "SWAP";
         case LocalSearchMethod::SHIFT:  return "SHIFT";
         case LocalSearchMethod::INVERT: return "INVERT";
+        case LocalSearchMethod::VND:    return "VND";
     }
     return "UNKNOWN";
 }
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 #include "../algorithm/LocalSearch.h"
 
 /**
@@ -13,6 +14,75 @@
  */
 double calculate_path_cost(const std::vector<std::vector<double>>& weights, const std::vector<int>& path);
 
+/**
+ * @brief Calcula o custo total de um caminho com pesos inteiros em ponto fixo, acumulando em 64 bits
+ * @param weights A matriz de pesos escalados entre os nós do grafo
+ * @param path o caminho com a ordem dos índices dos nós visitados
+ * @return O custo total do caminho, na mesma escala dos pesos
+ */
+int64_t calculate_path_cost(const std::vector<std::vector<int32_t>>& weights, const std::vector<int>& path);
+
+/**
+ * @brief Matriz de pesos em um único vetor contíguo, linha a linha, usada na avaliação de caminhos em lote
+ */
+struct FlatWeights {
+    size_t order = 0; // Número de nós
+    std::vector<double> values; // values[i * order + j] é o peso da aresta (i, j)
+};
+
+/**
+ * @brief Copia a matriz de pesos para um vetor contíguo
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @return A matriz plana
+ */
+FlatWeights flatten_weights(const std::vector<std::vector<double>>& weights);
+
+/**
+ * @brief Calcula o custo de um caminho sobre a matriz plana
+ *
+ * Com AVX2 (verificado em tempo de execução) os pesos de quatro arestas são lidos por uma única instrução
+ * gather, em dois acumuladores vetoriais; sem AVX2 a soma escalar usa quatro acumuladores independentes.
+ * A ordem das somas difere da de calculate_path_cost, então os resultados podem variar no último bit.
+ *
+ * @param weights A matriz plana
+ * @param path Os índices dos nós visitados
+ * @param path_size O número de nós do caminho
+ * @return O custo total do caminho, incluindo a aresta de volta ao primeiro nó
+ */
+double calculate_path_cost(const FlatWeights& weights, const int* path, size_t path_size);
+
+/**
+ * @brief Calcula o custo de vários caminhos de mesmo tamanho de uma vez
+ *
+ * Com AVX2 os caminhos são avaliados em grupos de quatro, um por pista do vetor, com um gather por aresta
+ * para os quatro caminhos. Instanciada para nós em int, uint16_t e uint32_t.
+ *
+ * @tparam Index O tipo inteiro em que os nós dos caminhos são guardados
+ * @param weights A matriz plana
+ * @param paths Os caminhos, cada um com path_size nós
+ * @param path_size O número de nós de cada caminho
+ * @param costs Recebe o custo de cada caminho, na mesma ordem
+ */
+template<typename Index>
+void calculate_path_costs(const FlatWeights& weights, const std::vector<const Index*>& paths, size_t path_size,
+                          std::vector<double>& costs);
+
+/**
+ * @brief Verifica se a matriz de pesos é simétrica
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @return true se weights[i][j] == weights[j][i] para todo par de nós
+ */
+bool is_symmetric(const std::vector<std::vector<double>>& weights);
+bool is_symmetric(const std::vector<std::vector<int32_t>>& weights);
+
+/**
+ * @brief Constrói as listas de candidatos com os k vizinhos mais próximos de cada nó
+ * @param weights A matriz de pesos entre os nós do grafo
+ * @param k O número máximo de candidatos por nó
+ * @return Para cada nó, os índices dos seus vizinhos ordenados do mais próximo ao mais distante
+ */
+std::vector<std::vector<int>> build_candidate_lists(const std::vector<std::vector<double>>& weights, size_t k);
+
 /**
  * @brief Converte o método de busca local para string
  * @param m O método de busca local
@@ -0,0 +1,219 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class WorkStealingPool
+ * @brief Conjunto de threads com uma fila de tarefas por thread e roubo de tarefas entre elas.
+ *
+ * Tarefas submetidas por uma thread do conjunto entram no fim da sua própria fila, e cada thread
+ * consome a própria fila pelo fim (a tarefa mais recente, cujos dados ainda estão em cache). Quando a
+ * própria fila esvazia, a thread rouba a tarefa mais antiga da fila de outra thread, que costuma ser a
+ * maior porção de trabalho pendente. Tarefas submetidas de fora do conjunto são distribuídas em
+ * rodízio entre as filas.
+ */
+class WorkStealingPool {
+    private:
+        /*Fila de tarefas de uma thread, protegida pela sua própria trava*/
+        struct WorkerQueue {
+            std::deque<std::function<void()>> tasks;
+            std::mutex mutex;
+        };
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::vector<std::thread> workers;
+        /*Tarefas submetidas e ainda não concluídas*/
+        std::atomic<size_t> pending;
+        /*Tarefas presentes nas filas, aguardando uma thread*/
+        std::atomic<size_t> queued;
+        std::atomic<size_t> next_queue;
+        std::atomic<bool> stopping;
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        std::condition_variable idle;
+
+        /*Conjunto e índice da thread que executa o código atual (nulo fora de qualquer conjunto)*/
+        static std::pair<const WorkStealingPool*, size_t>& current_worker() {
+            thread_local std::pair<const WorkStealingPool*, size_t> worker = {nullptr, 0};
+            return worker;
+        }
+
+        /*Retira uma tarefa da própria fila ou rouba de outra thread*/
+        bool take_task(size_t index, std::function<void()>& task) {
+            {
+                std::lock_guard<std::mutex> lock(queues[index]->mutex);
+                if (!queues[index]->tasks.empty()) {
+                    task = std::move(queues[index]->tasks.back());
+                    queues[index]->tasks.pop_back();
+                    queued--;
+                    return true;
+                }
+            }
+
+            for (size_t offset = 1; offset < queues.size(); offset++) {
+                WorkerQueue& victim = *queues[(index + offset) % queues.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty()) {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    queued--;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void run_worker(size_t index) {
+            current_worker() = {this, index};
+            std::function<void()> task;
+
+            while (true) {
+                if (take_task(index, task)) {
+                    task();
+                    task = nullptr;
+
+                    /*A última tarefa concluída acorda quem aguarda em wait()*/
+                    if (--pending == 0) {
+                        std::lock_guard<std::mutex> lock(sleep_mutex);
+                        idle.notify_all();
+                    }
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                wake.wait(lock, [&]() { return stopping || queued > 0; });
+                if (stopping && queued == 0) {
+                    return;
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Cria o conjunto de threads.
+         * @param threads O número de threads (0 utiliza uma por núcleo disponível).
+         */
+        explicit WorkStealingPool(size_t threads = 0) : pending(0), queued(0), next_queue(0), stopping(false) {
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            for (size_t i = 0; i < threads; i++) {
+                queues.push_back(std::make_unique<WorkerQueue>());
+            }
+            for (size_t i = 0; i < threads; i++) {
+                workers.emplace_back(&WorkStealingPool::run_worker, this, i);
+            }
+        }
+
+        /**
+         * @brief Aguarda as tarefas pendentes e encerra as threads.
+         */
+        ~WorkStealingPool() {
+            wait();
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /**
+         * @brief Retorna o número de threads do conjunto.
+         */
+        size_t size() const {
+            return workers.size();
+        }
+
+        /**
+         * @brief Submete uma tarefa para execução.
+         * @param task A tarefa; pode submeter novas tarefas durante a execução.
+         */
+        void submit(std::function<void()> task) {
+            const auto& worker = current_worker();
+            size_t index = worker.first == this ? worker.second : next_queue++ % queues.size();
+
+            pending++;
+            {
+                /*queued é incrementado junto com a inserção, sob a trava da fila, para que uma thread que
+                  retire a tarefa logo em seguida nunca o decremente antes; a trava de sono impede que uma
+                  thread verifique queued e durma sem receber o aviso abaixo*/
+                std::lock_guard<std::mutex> sleep_lock(sleep_mutex);
+                std::lock_guard<std::mutex> lock(queues[index]->mutex);
+                queued++;
+                queues[index]->tasks.push_back(std::move(task));
+            }
+            wake.notify_one();
+        }
+
+        /**
+         * @brief Executa body(0), ..., body(count - 1) em paralelo e aguarda apenas essas chamadas.
+         *
+         * body(0) roda na thread chamadora e as demais são submetidas ao conjunto. Diferente de wait(),
+         * não depende das outras tarefas pendentes, então várias threads de fora do conjunto podem usá-lo
+         * ao mesmo tempo. Não deve ser chamado de dentro de uma tarefa.
+         *
+         * @param count O número de chamadas.
+         * @param body A função chamada com o índice de cada porção.
+         */
+        void run_batch(size_t count, const std::function<void(size_t)>& body) {
+            if (count == 0) {
+                return;
+            }
+
+            std::mutex done_mutex;
+            std::condition_variable done;
+            size_t remaining = count - 1;
+
+            for (size_t k = 1; k < count; k++) {
+                submit([&, k]() {
+                    body(k);
+                    std::lock_guard<std::mutex> lock(done_mutex);
+                    if (--remaining == 0) {
+                        done.notify_one();
+                    }
+                });
+            }
+            body(0);
+
+            std::unique_lock<std::mutex> lock(done_mutex);
+            done.wait(lock, [&]() { return remaining == 0; });
+        }
+
+        /**
+         * @brief Indica se o código atual executa em uma thread de algum conjunto, ou seja, se já faz
+         * parte de um trabalho paralelizado.
+         */
+        static bool on_worker() {
+            return current_worker().first != nullptr;
+        }
+
+        /**
+         * @brief Bloqueia até que todas as tarefas submetidas, inclusive as criadas por outras tarefas,
+         * sejam concluídas. Não deve ser chamado de dentro de uma tarefa.
+         */
+        void wait() {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            idle.wait(lock, [&]() { return pending == 0; });
+        }
+};
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,97 @@
+#ifndef TOUR_HASH_H
+#define TOUR_HASH_H
+
+#include <vector>
+#include <algorithm>
+#include <initializer_list>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Calcula a chave de Zobrist de uma aresta não direcionada
+ *
+ * A chave é derivada do par ordenado (menor, maior) por uma função de mistura (splitmix64), então não
+ * depende de tabela por instância e é a mesma nos dois sentidos da aresta.
+ *
+ * @param a Uma extremidade
+ * @param b A outra extremidade
+ * @return A chave de 64 bits da aresta
+ */
+inline uint64_t edge_hash(int a, int b) {
+    uint64_t key = ((uint64_t)(uint32_t)std::min(a, b) << 32) | (uint32_t)std::max(a, b);
+    key += 0x9e3779b97f4a7c15ull;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+    return key ^ (key >> 31);
+}
+
+/**
+ * @brief Calcula o hash de um caminho como o XOR das chaves das suas arestas
+ *
+ * Rotações e inversões do ciclo têm as mesmas arestas não direcionadas e portanto o mesmo hash.
+ *
+ * @tparam Tour Um std::vector<int> ou uma visão de caminho com size() e operator[]
+ * @param path O caminho
+ * @return O hash do ciclo
+ */
+template<typename Tour>
+uint64_t tour_hash(const Tour& path) {
+    uint64_t hash = 0;
+    size_t total_nodes = path.size();
+    for (size_t k = 0; k < total_nodes; k++) {
+        hash ^= edge_hash(path[k], path[(k + 1) % total_nodes]);
+    }
+    return hash;
+}
+
+/**
+ * @brief Calcula o XOR das chaves das arestas que partem das posições indicadas
+ *
+ * A aresta da posição k liga path[k] a path[k + 1] (circularmente). Posições repetidas são consideradas
+ * uma única vez. Aplicado antes e depois de uma modificação que só altera essas arestas, o XOR dos dois
+ * valores atualiza o hash do caminho sem percorrê-lo.
+ *
+ * @param path O caminho
+ * @param positions As posições das arestas
+ * @return O XOR das chaves das arestas
+ */
+inline uint64_t edges_hash(const std::vector<int>& path, std::initializer_list<int> positions) {
+    int total_nodes = path.size();
+    int seen[8];
+    int count = 0;
+    uint64_t hash = 0;
+
+    for (int position : positions) {
+        int k = ((position % total_nodes) + total_nodes) % total_nodes;
+        if (std::find(seen, seen + count, k) != seen + count) {
+            continue;
+        }
+        seen[count++] = k;
+        hash ^= edge_hash(path[k], path[(k + 1) % total_nodes]);
+    }
+    return hash;
+}
+
+/**
+ * @brief Calcula o XOR das chaves das arestas das posições first..last (circularmente)
+ *
+ * Se o intervalo tiver mais posições que o caminho, apenas as últimas são consideradas, de forma que
+ * cada aresta entre no XOR uma única vez.
+ *
+ * @param path O caminho
+ * @param first A primeira posição, podendo ser -1
+ * @param last A última posição
+ * @return O XOR das chaves das arestas
+ */
+inline uint64_t range_edges_hash(const std::vector<int>& path, int first, int last) {
+    int total_nodes = path.size();
+    uint64_t hash = 0;
+    first = std::max(first, last - total_nodes + 1);
+    for (int position = first; position <= last; position++) {
+        int k = ((position % total_nodes) + total_nodes) % total_nodes;
+        hash ^= edge_hash(path[k], path[(k + 1) % total_nodes]);
+    }
+    return hash;
+}
+
+#endif // TOUR_HASH_H